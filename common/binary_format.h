@@ -0,0 +1,220 @@
+#ifndef BINARY_FORMAT_H
+#define BINARY_FORMAT_H
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <memory>
+#include <cstring>
+#include <cstdint>
+
+#include "set_system.h"
+#include "csr_graph.h"
+#include "mapped_file.h"
+
+// Бинарный формат экземпляров (версия 1, порядок байт машины — little-endian на x86/ARM).
+// Заголовок 64 байта, затем массивы, каждый выровнен на 8 байт:
+//   множества: offsets int32[count + 1], elements int32[total], costs double[count] (если есть);
+//   графы (CSR, каждое ребро в обе стороны): offsets int64[count + 1], neighbors int32[total],
+//   weights int32[count] (если есть).
+// Загрузка отображает файл в память и использует массивы на месте, без разбора и копирования.
+
+const char SET_SYSTEM_MAGIC[8] = {'S', 'C', 'S', 'E', 'T', 'S', 0, 0};
+const char GRAPH_MAGIC[8] = {'S', 'C', 'G', 'R', 'A', 'P', 'H', 0};
+const uint32_t BINARY_FORMAT_VERSION = 1;
+const uint32_t BINARY_HAS_WEIGHTS = 1;
+
+struct BinaryHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t flags;
+    uint64_t count;      // число множеств / вершин
+    uint64_t universe;   // число элементов универсума / рёбер
+    uint64_t total;      // длина массива elements / neighbors
+    uint64_t offsetsPos; // смещения массивов от начала файла
+    uint64_t dataPos;
+    uint64_t weightsPos; // 0, если весов нет
+};
+
+static_assert(sizeof(BinaryHeader) == 64, "BinaryHeader must be 64 bytes");
+
+inline uint64_t alignTo8(uint64_t position) {
+    return (position + 7) & ~uint64_t(7);
+}
+
+inline bool writeBinaryInstance(const std::string &path, const char *magic, uint64_t count, uint64_t universe,
+                                const void *offsets, std::size_t offsetBytes,
+                                const int *data, uint64_t total,
+                                const void *weights, std::size_t weightBytes) {
+    std::ofstream output(path, std::ios::binary);
+    if (!output) {
+        std::cout << "Cannot create " << path << std::endl;
+        return false;
+    }
+
+    BinaryHeader header{};
+    std::memcpy(header.magic, magic, 8);
+    header.version = BINARY_FORMAT_VERSION;
+    header.flags = weights ? BINARY_HAS_WEIGHTS : 0;
+    header.count = count;
+    header.universe = universe;
+    header.total = total;
+    header.offsetsPos = sizeof(BinaryHeader);
+    header.dataPos = alignTo8(header.offsetsPos + offsetBytes);
+    header.weightsPos = weights ? alignTo8(header.dataPos + total * sizeof(int)) : 0;
+
+    const char zeros[8] = {};
+    auto pad = [&](uint64_t position) {
+        uint64_t current = output.tellp();
+        output.write(zeros, position - current);
+    };
+
+    output.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    output.write(static_cast<const char *>(offsets), offsetBytes);
+    pad(header.dataPos);
+    output.write(reinterpret_cast<const char *>(data), total * sizeof(int));
+    if (weights) {
+        pad(header.weightsPos);
+        output.write(static_cast<const char *>(weights), weightBytes);
+    }
+    return bool(output);
+}
+
+// Открытие и проверка заголовка; при успехе file остаётся отображённым
+inline const BinaryHeader *openBinaryInstance(const std::string &path, const char *magic,
+                                              std::size_t offsetSize, std::size_t weightSize,
+                                              std::shared_ptr<MappedFile> &file) {
+    file = std::make_shared<MappedFile>();
+    if (!file->open(path)) {
+        std::cout << "Cannot open " << path << std::endl;
+        return nullptr;
+    }
+    if (file->size() < sizeof(BinaryHeader)) {
+        std::cout << path << " is too small to be a binary instance" << std::endl;
+        return nullptr;
+    }
+    auto header = reinterpret_cast<const BinaryHeader *>(file->data());
+    if (std::memcmp(header->magic, magic, 8) != 0) {
+        std::cout << path << " has an unexpected magic number" << std::endl;
+        return nullptr;
+    }
+    if (header->version != BINARY_FORMAT_VERSION) {
+        std::cout << path << " has unsupported format version " << header->version << std::endl;
+        return nullptr;
+    }
+
+    bool hasWeights = header->flags & BINARY_HAS_WEIGHTS;
+    uint64_t size = file->size();
+    // Позиции сравниваются с размером до вычитания, длины — делением: произведение из повреждённого
+    // заголовка могло бы переполниться и пройти проверку
+    bool valid = header->offsetsPos % 8 == 0 && header->dataPos % 8 == 0 && header->weightsPos % 8 == 0 &&
+                 header->count < (uint64_t(1) << 31) &&
+                 header->offsetsPos <= size && header->count + 1 <= (size - header->offsetsPos) / offsetSize &&
+                 header->dataPos <= size && header->total <= (size - header->dataPos) / sizeof(int) &&
+                 (!hasWeights || (header->weightsPos <= size && header->count <= (size - header->weightsPos) / weightSize));
+    if (!valid) {
+        std::cout << path << " is truncated or corrupted" << std::endl;
+        return nullptr;
+    }
+    return header;
+}
+
+// Один проход по массивам: смещения не убывают и ограничены total, номера лежат в [0, limit).
+// Без проверки повреждённый файл дал бы чтение за пределами отображения уже в алгоритме.
+template <typename Offset>
+bool validBinaryArrays(const Offset *offsets, const int *data, const BinaryHeader *header, uint64_t limit) {
+    if (offsets[0] != 0 || (uint64_t) offsets[header->count] != header->total) return false;
+    for (uint64_t i = 0; i < header->count; ++i) {
+        if (offsets[i] > offsets[i + 1]) return false;
+    }
+    for (uint64_t i = 0; i < header->total; ++i) {
+        if (data[i] < 0 || (uint64_t) data[i] >= limit) return false;
+    }
+    return true;
+}
+
+inline bool writeSetSystemBinary(const std::string &path, const SetSystem &sets, int n) {
+    std::vector<int> offsets(sets.size() + 1);
+    const int *elementData = sets.size() > 0 ? sets[0].begin() : nullptr;
+    for (int i = 0; i < sets.size(); ++i) {
+        offsets[i + 1] = sets[i].end() - elementData;
+    }
+    std::vector<double> costs;
+    if (sets.weighted()) {
+        costs.resize(sets.size());
+        for (int i = 0; i < sets.size(); ++i) {
+            costs[i] = sets.cost(i);
+        }
+    }
+    return writeBinaryInstance(path, SET_SYSTEM_MAGIC, sets.size(), n,
+                               offsets.data(), offsets.size() * sizeof(int),
+                               elementData, sets.totalSize(),
+                               costs.empty() ? nullptr : costs.data(), costs.size() * sizeof(double));
+}
+
+inline bool loadSetSystemBinary(const std::string &path, SetSystem &sets, int &n) {
+    std::shared_ptr<MappedFile> file;
+    const BinaryHeader *header = openBinaryInstance(path, SET_SYSTEM_MAGIC, sizeof(int), sizeof(double), file);
+    if (!header) return false;
+
+    const char *base = file->data();
+    const int *offsets = reinterpret_cast<const int *>(base + header->offsetsPos);
+    const int *elements = reinterpret_cast<const int *>(base + header->dataPos);
+    if (header->universe >= (uint64_t(1) << 31) || !validBinaryArrays(offsets, elements, header, header->universe)) {
+        std::cout << path << " has inconsistent offsets or elements" << std::endl;
+        return false;
+    }
+
+    sets = SetSystem();
+    sets.offsets.clear();
+    sets.mappedCount = header->count;
+    sets.mappedOffsets = offsets;
+    sets.mappedElements = elements;
+    sets.mappedCosts = header->flags & BINARY_HAS_WEIGHTS ? reinterpret_cast<const double *>(base + header->weightsPos) : nullptr;
+    sets.mapping = file;
+    n = header->universe;
+    return true;
+}
+
+inline bool writeGraphBinary(const std::string &path, const CsrGraph &graph) {
+    std::vector<int> weights;
+    if (graph.weighted()) {
+        weights.resize(graph.V);
+        for (int v = 0; v < graph.V; ++v) {
+            weights[v] = graph.weight(v);
+        }
+    }
+    return writeBinaryInstance(path, GRAPH_MAGIC, graph.V, graph.E,
+                               graph.offsetData(), (graph.V + 1) * sizeof(long long),
+                               graph.neighborData(), graph.offsetData()[graph.V],
+                               weights.empty() ? nullptr : weights.data(), weights.size() * sizeof(int));
+}
+
+// Граф отображается в память без копирования: CsrGraph ссылается на массивы файла
+inline bool loadGraphBinary(const std::string &path, CsrGraph &graph) {
+    std::shared_ptr<MappedFile> file;
+    const BinaryHeader *header = openBinaryInstance(path, GRAPH_MAGIC, sizeof(long long), sizeof(int), file);
+    if (!header) return false;
+
+    const char *base = file->data();
+    const long long *offsets = reinterpret_cast<const long long *>(base + header->offsetsPos);
+    const int *neighbors = reinterpret_cast<const int *>(base + header->dataPos);
+    // Каждое ребро хранится в обе стороны, поэтому число рёбер — ровно половина total
+    if (header->total % 2 != 0 || header->universe != header->total / 2 || !validBinaryArrays(offsets, neighbors, header, header->count)) {
+        std::cout << path << " has inconsistent offsets, neighbors or edge count" << std::endl;
+        return false;
+    }
+
+    graph = CsrGraph();
+    graph.offsets.clear();
+    graph.V = header->count;
+    graph.E = header->universe;
+    graph.mappedOffsets = offsets;
+    graph.mappedNeighbors = neighbors;
+    graph.mappedWeights = header->flags & BINARY_HAS_WEIGHTS ? reinterpret_cast<const int *>(base + header->weightsPos) : nullptr;
+    graph.mapping = file;
+    return true;
+}
+
+#endif // BINARY_FORMAT_H
@@ -0,0 +1,132 @@
+#ifndef BITSET_OPS_H
+#define BITSET_OPS_H
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define BITSET_OPS_X86 1
+#endif
+
+// Битовые операции над массивами 64-битных слов: покрытие универсума и плотные множества
+
+inline int bitsetWords(int n) {
+    return (n + 63) / 64;
+}
+
+inline void setBit(std::vector<uint64_t> &bits, int i) {
+    bits[i >> 6] |= uint64_t(1) << (i & 63);
+}
+
+inline void clearBit(std::vector<uint64_t> &bits, int i) {
+    bits[i >> 6] &= ~(uint64_t(1) << (i & 63));
+}
+
+inline bool testBit(const uint64_t *bits, int i) {
+    return (bits[i >> 6] >> (i & 63)) & 1;
+}
+
+inline int popcount64(uint64_t x) {
+#if defined(__GNUC__)
+    return __builtin_popcountll(x);
+#else
+    x = x - ((x >> 1) & 0x5555555555555555ULL);
+    x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+    x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return (x * 0x0101010101010101ULL) >> 56;
+#endif
+}
+
+// popcount(a & b)
+inline std::size_t andPopcount(const uint64_t *a, const uint64_t *b, std::size_t words) {
+    std::size_t count = 0;
+    for (std::size_t w = 0; w < words; ++w) {
+        count += popcount64(a[w] & b[w]);
+    }
+    return count;
+}
+
+// popcount(a & ~b) — скалярная версия
+inline std::size_t andNotPopcountScalar(const uint64_t *a, const uint64_t *b, std::size_t words) {
+    std::size_t count = 0;
+    for (std::size_t w = 0; w < words; ++w) {
+        count += popcount64(a[w] & ~b[w]);
+    }
+    return count;
+}
+
+#ifdef BITSET_OPS_X86
+// AVX2: popcount по таблице полубайтов (vpshufb) и суммирование байтов через vpsadbw
+__attribute__((target("avx2")))
+inline std::size_t andNotPopcountAvx2(const uint64_t *a, const uint64_t *b, std::size_t words) {
+    const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                            0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i lowMask = _mm256_set1_epi8(0x0F);
+    __m256i total = _mm256_setzero_si256();
+    std::size_t w = 0;
+    for (; w + 4 <= words; w += 4) {
+        __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + w));
+        __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + w));
+        __m256i v = _mm256_andnot_si256(vb, va);
+        __m256i lo = _mm256_shuffle_epi8(lookup, _mm256_and_si256(v, lowMask));
+        __m256i hi = _mm256_shuffle_epi8(lookup, _mm256_and_si256(_mm256_srli_epi16(v, 4), lowMask));
+        total = _mm256_add_epi64(total, _mm256_sad_epu8(_mm256_add_epi8(lo, hi), _mm256_setzero_si256()));
+    }
+    alignas(32) uint64_t lanes[4];
+    _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), total);
+    std::size_t count = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    return count + andNotPopcountScalar(a + w, b + w, words - w);
+}
+
+// AVX-512: аппаратный vpopcntq
+__attribute__((target("avx512f,avx512vpopcntdq")))
+inline std::size_t andNotPopcountAvx512(const uint64_t *a, const uint64_t *b, std::size_t words) {
+    const __m512i ones = _mm512_set1_epi64(-1);
+    __m512i total = _mm512_setzero_si512();
+    std::size_t w = 0;
+    for (; w + 8 <= words; w += 8) {
+        __m512i va = _mm512_loadu_si512(a + w);
+        __m512i vb = _mm512_loadu_si512(b + w);
+        total = _mm512_add_epi64(total, _mm512_popcnt_epi64(_mm512_and_si512(va, _mm512_xor_si512(vb, ones))));
+    }
+    alignas(64) uint64_t lanes[8];
+    _mm512_store_si512(lanes, total);
+    std::size_t count = 0;
+    for (uint64_t lane : lanes) {
+        count += lane;
+    }
+    return count + andNotPopcountScalar(a + w, b + w, words - w);
+}
+#endif
+
+using AndNotPopcountKernel = std::size_t (*)(const uint64_t *, const uint64_t *, std::size_t);
+
+// Выбор ядра по возможностям процессора (один раз за запуск)
+inline AndNotPopcountKernel selectAndNotPopcountKernel(const char **name = nullptr) {
+    AndNotPopcountKernel kernel = andNotPopcountScalar;
+    const char *kernelName = "scalar";
+#ifdef BITSET_OPS_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512vpopcntdq")) {
+        kernel = andNotPopcountAvx512;
+        kernelName = "avx512";
+    } else if (__builtin_cpu_supports("avx2")) {
+        kernel = andNotPopcountAvx2;
+        kernelName = "avx2";
+    }
+#endif
+    if (name) {
+        *name = kernelName;
+    }
+    return kernel;
+}
+
+// popcount(a & ~b) с лучшим доступным ядром
+inline std::size_t andNotPopcount(const uint64_t *a, const uint64_t *b, std::size_t words) {
+    static const AndNotPopcountKernel kernel = selectAndNotPopcountKernel();
+    return kernel(a, b, words);
+}
+
+#endif // BITSET_OPS_H
@@ -0,0 +1,183 @@
+#ifndef CSR_GRAPH_H
+#define CSR_GRAPH_H
+
+#include <vector>
+#include <utility>
+#include <memory>
+#include <atomic>
+#include <algorithm>
+
+#include "thread_pool.h"
+
+// Список рёбер для построения графа: генераторы и ввод добавляют рёбра по одному
+struct EdgeList {
+    int V;
+    std::vector<std::pair<int, int>> edges;
+    std::vector<int> weights; // пусто — граф без весов
+
+    explicit EdgeList(int V) : V(V) {}
+
+    void addEdge(int u, int v) {
+        edges.emplace_back(u, v);
+    }
+
+    void setWeight(int v, int w) {
+        if (weights.empty()) {
+            weights.assign(V, 0);
+        }
+        weights[v] = w;
+    }
+};
+
+// Неориентированный граф в формате CSR: соседи вершины v — neighbors[offsets[v], offsets[v + 1]),
+// каждое ребро хранится в обе стороны; buildCsrGraph сортирует списки соседей и убирает петли и повторы.
+// Массивы могут лежать в отображённом в память файле (см. binary_format.h), тогда векторы пусты.
+struct CsrGraph {
+    // Лёгкое представление списка соседей для range-for
+    struct NeighborView {
+        const int *first;
+        const int *last;
+
+        const int *begin() const { return first; }
+        const int *end() const { return last; }
+        int size() const { return last - first; }
+    };
+
+    int V = 0;
+    long long E = 0;
+    std::vector<long long> offsets{0};
+    std::vector<int> neighbors;
+    std::vector<int> weights; // пусто — все веса равны 1
+
+    // Внешние массивы (отображённый файл); mapping держит отображение, пока жив граф
+    const long long *mappedOffsets = nullptr;
+    const int *mappedNeighbors = nullptr;
+    const int *mappedWeights = nullptr;
+    std::shared_ptr<const void> mapping;
+
+    const long long *offsetData() const {
+        return mappedOffsets ? mappedOffsets : offsets.data();
+    }
+
+    const int *neighborData() const {
+        return mappedOffsets ? mappedNeighbors : neighbors.data();
+    }
+
+    NeighborView neighborsOf(int v) const {
+        const long long *offset = offsetData();
+        return {neighborData() + offset[v], neighborData() + offset[v + 1]};
+    }
+
+    int degree(int v) const {
+        const long long *offset = offsetData();
+        return offset[v + 1] - offset[v];
+    }
+
+    bool weighted() const {
+        return mappedWeights || !weights.empty();
+    }
+
+    int weight(int v) const {
+        if (mappedWeights) return mappedWeights[v];
+        return weights.empty() ? 1 : weights[v];
+    }
+};
+
+// Что отброшено при построении графа
+struct CsrBuildStats {
+    long long selfLoops = 0;
+    long long duplicateEdges = 0;
+};
+
+// Параллельное построение CSR из списка рёбер: подсчёт степеней атомарными счётчиками,
+// префиксные суммы, раскладка соседей и сортировка каждого списка соседей по диапазонам вершин
+// (после сортировки результат не зависит от порядка раскладки). В отсортированных списках
+// повторные рёбра и петли стоят рядом и удаляются; E — число оставшихся рёбер.
+inline CsrGraph buildCsrGraph(const EdgeList &edgeList, ThreadPool &pool, CsrBuildStats *stats = nullptr) {
+    int V = edgeList.V;
+    const auto &edges = edgeList.edges;
+    long long edgeCount = edges.size();
+    int tasks = pool.size() * 4;
+
+    CsrGraph graph;
+    graph.V = V;
+    graph.weights = edgeList.weights;
+
+    std::vector<std::atomic<long long>> cursor(V + 1);
+    pool.parallelFor(tasks, [&](int task) {
+        for (long long v = (long long) (V + 1) * task / tasks; v < (long long) (V + 1) * (task + 1) / tasks; ++v) {
+            cursor[v].store(0, std::memory_order_relaxed);
+        }
+    });
+    pool.parallelFor(tasks, [&](int task) {
+        for (long long i = edgeCount * task / tasks; i < edgeCount * (task + 1) / tasks; ++i) {
+            cursor[edges[i].first].fetch_add(1, std::memory_order_relaxed);
+            cursor[edges[i].second].fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+
+    std::vector<long long> offsets(V + 1, 0);
+    for (int v = 0; v < V; ++v) {
+        long long degree = cursor[v].load(std::memory_order_relaxed);
+        offsets[v + 1] = offsets[v] + degree;
+        cursor[v].store(offsets[v], std::memory_order_relaxed);
+    }
+
+    std::vector<int> neighbors(offsets[V]);
+    pool.parallelFor(tasks, [&](int task) {
+        for (long long i = edgeCount * task / tasks; i < edgeCount * (task + 1) / tasks; ++i) {
+            auto [u, v] = edges[i];
+            neighbors[cursor[u].fetch_add(1, std::memory_order_relaxed)] = v;
+            neighbors[cursor[v].fetch_add(1, std::memory_order_relaxed)] = u;
+        }
+    });
+
+    // Сортировка и сжатие списков на месте; degree — новая длина списка
+    std::vector<int> degree(V);
+    std::vector<long long> taskSelfEntries(tasks, 0);
+    std::vector<long long> taskDuplicateEntries(tasks, 0);
+    pool.parallelFor(tasks, [&](int task) {
+        for (long long v = (long long) V * task / tasks; v < (long long) V * (task + 1) / tasks; ++v) {
+            int *first = neighbors.data() + offsets[v];
+            int *last = neighbors.data() + offsets[v + 1];
+            std::sort(first, last);
+            int *write = first;
+            for (int *p = first; p < last; ++p) {
+                if (*p == v) {
+                    taskSelfEntries[task]++;
+                } else if (write > first && write[-1] == *p) {
+                    taskDuplicateEntries[task]++;
+                } else {
+                    *write++ = *p;
+                }
+            }
+            degree[v] = write - first;
+        }
+    });
+
+    // Перенос сжатых списков в новый массив по тем же диапазонам вершин
+    graph.offsets.assign(V + 1, 0);
+    for (int v = 0; v < V; ++v) {
+        graph.offsets[v + 1] = graph.offsets[v] + degree[v];
+    }
+    graph.neighbors.resize(graph.offsets[V]);
+    pool.parallelFor(tasks, [&](int task) {
+        for (long long v = (long long) V * task / tasks; v < (long long) V * (task + 1) / tasks; ++v) {
+            std::copy(neighbors.begin() + offsets[v], neighbors.begin() + offsets[v] + degree[v],
+                      graph.neighbors.begin() + graph.offsets[v]);
+        }
+    });
+    graph.E = graph.offsets[V] / 2;
+
+    if (stats) {
+        // Петля даёт две записи в списке своей вершины, повторное ребро — по одной в списке каждого конца
+        for (int task = 0; task < tasks; ++task) {
+            stats->selfLoops += taskSelfEntries[task] / 2;
+            stats->duplicateEdges += taskDuplicateEntries[task];
+        }
+        stats->duplicateEdges /= 2;
+    }
+    return graph;
+}
+
+#endif // CSR_GRAPH_H
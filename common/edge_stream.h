@@ -0,0 +1,136 @@
+#ifndef EDGE_STREAM_H
+#define EDGE_STREAM_H
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+
+#include "graph_reader.h"
+#include "mapped_file.h"
+
+// Потоковое чтение рёбер DIMACS и SNAP без загрузки графа: каждое ребро передаётся обработчику
+// сразу после разбора, в памяти держится только текущий блок. Обычный файл отображается в память
+// и читается на месте (ядро само вытесняет прочитанные страницы), канал или стандартный ввод
+// (путь "-") читается блоками с переносом незаконченной строки.
+
+// Вызов handler(начало строки, конец строки) для каждой строки; false из обработчика прерывает чтение
+template <typename LineHandler>
+bool forEachLine(const std::string &path, LineHandler handler) {
+    // Канал не отображается в память, его приходится читать блоками
+    std::error_code error;
+    MappedFile file;
+    if (path != "-" && std::filesystem::is_regular_file(path, error) && file.open(path)) {
+        const char *p = file.data();
+        const char *end = p + file.size();
+        while (p < end) {
+            const char *eol = lineEnd(p, end);
+            if (!handler(p, eol)) return false;
+            p = eol + 1;
+        }
+        return true;
+    }
+
+    std::FILE *input = path == "-" ? stdin : std::fopen(path.c_str(), "rb");
+    if (!input) {
+        std::cout << "Cannot open " << path << std::endl;
+        return false;
+    }
+    const std::size_t blockSize = 1 << 20;
+    std::vector<char> buffer(blockSize);
+    std::size_t carried = 0;
+    bool ok = true;
+    while (ok) {
+        if (carried == buffer.size()) {
+            buffer.resize(buffer.size() * 2); // строка длиннее блока
+        }
+        std::size_t read = std::fread(buffer.data() + carried, 1, buffer.size() - carried, input);
+        std::size_t filled = carried + read;
+        if (read == 0) {
+            // Последняя строка без перевода строки
+            if (filled > 0) {
+                ok = handler(buffer.data(), buffer.data() + filled);
+            }
+            break;
+        }
+        const char *p = buffer.data();
+        const char *end = buffer.data() + filled;
+        while (ok) {
+            const void *newline = std::memchr(p, '\n', end - p);
+            if (!newline) break;
+            ok = handler(p, static_cast<const char *>(newline));
+            p = static_cast<const char *>(newline) + 1;
+        }
+        carried = end - p;
+        std::memmove(buffer.data(), p, carried);
+    }
+    if (input != stdin) {
+        std::fclose(input);
+    }
+    return ok;
+}
+
+// Разбор рёбер по строкам: onVertexCount(V) вызывается по заголовку DIMACS, onEdge(u, v) — для
+// каждого ребра (вершины с нуля); false из обработчика прерывает чтение. Для SNAP число вершин
+// заранее неизвестно.
+template <typename VertexCountHandler, typename EdgeHandler>
+bool streamEdges(const std::string &path, GraphFormat format, VertexCountHandler onVertexCount, EdgeHandler onEdge) {
+    if (format == GraphFormat::Metis) {
+        std::cout << "METIS stores adjacency lists; streaming needs a DIMACS or SNAP edge list" << std::endl;
+        return false;
+    }
+    long long V = -1;
+    long long line = 0;
+    bool parsed = forEachLine(path, [&](const char *p, const char *eol) {
+        ++line;
+        if (p == eol) return true;
+        long long u, v;
+        if (format == GraphFormat::Snap) {
+            if (*p == '#' || *p == '%') return true;
+            // Пустая строка проверяется только при ошибке разбора, чтобы не просматривать каждую строку дважды
+            const char *first = p;
+            if (!readLineInteger(p, eol, u)) {
+                if (isBlankLine(first, eol)) return true;
+                std::cout << path << ": malformed line " << line << std::endl;
+                return false;
+            }
+            if (!readLineInteger(p, eol, v) || u < 0 || v < 0 || u >= (1LL << 31) - 1 || v >= (1LL << 31) - 1) {
+                std::cout << path << ": malformed line " << line << std::endl;
+                return false;
+            }
+            return onEdge(u, v);
+        }
+
+        if (*p == 'c' || isBlankLine(p, eol)) return true;
+        if (*p == 'p') {
+            const char *q = p + 1;
+            while (q < eol && (*q == ' ' || *q == '\t')) ++q;
+            while (q < eol && *q != ' ' && *q != '\t') ++q;
+            long long E;
+            if (V >= 0 || !readLineInteger(q, eol, V) || !readLineInteger(q, eol, E) || V < 0 || V >= (1LL << 31)) {
+                std::cout << path << ": invalid problem line" << std::endl;
+                return false;
+            }
+            return onVertexCount(V);
+        }
+        if (V < 0) {
+            std::cout << path << ": edge before the problem line" << std::endl;
+            return false;
+        }
+        ++p;
+        if (p[-1] != 'e' || !readLineInteger(p, eol, u) || !readLineInteger(p, eol, v) || u < 1 || u > V || v < 1 || v > V) {
+            std::cout << path << ": malformed line " << line << std::endl;
+            return false;
+        }
+        return onEdge(u - 1, v - 1);
+    });
+    if (parsed && format == GraphFormat::Dimacs && V < 0) {
+        std::cout << path << ": missing problem line" << std::endl;
+        return false;
+    }
+    return parsed;
+}
+
+#endif // EDGE_STREAM_H
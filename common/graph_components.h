@@ -0,0 +1,207 @@
+#ifndef GRAPH_COMPONENTS_H
+#define GRAPH_COMPONENTS_H
+
+#include <vector>
+#include <atomic>
+#include <algorithm>
+#include <numeric>
+#include <chrono>
+
+#include "csr_graph.h"
+#include "thread_pool.h"
+
+// Разбиение графа на компоненты связности. Крупная компонента становится отдельной частью,
+// мелкие собираются в части примерно одинаковой работы (несвязное объединение в одном CSR),
+// чтобы не платить за граф и задачу на каждую. Внутри компоненты локальные номера возрастают
+// вместе с исходными, поэтому списки соседей остаются отсортированными, а выбор «меньшего номера»
+// в алгоритмах не меняется. Изолированные вершины в части не входят — в покрытие они не попадают.
+struct GraphComponents {
+    std::vector<CsrGraph> graphs;           // части по убыванию работы (V + E)
+    std::vector<std::vector<int>> vertices; // локальный номер в части -> номер в исходном графе
+    int components = 0;
+    int isolated = 0;
+    long long decompositionTime = 0; // мкс
+};
+
+// Сводка разбиения для отчёта вызывающей стороны: сами части к этому моменту уже не нужны
+struct ComponentStats {
+    int components = 0;
+    int parts = 0;
+    int isolated = 0;
+    long long decompositionTime = 0; // мкс
+};
+
+inline ComponentStats componentStats(const GraphComponents &components) {
+    return {components.components, (int) components.graphs.size(), components.isolated, components.decompositionTime};
+}
+
+// Корень с сокращением пути вдвое; ссылка всегда ведёт к меньшему номеру
+inline int findComponentRoot(std::vector<std::atomic<int>> &parent, int v) {
+    while (true) {
+        int p = parent[v].load(std::memory_order_relaxed);
+        if (p == v) return v;
+        int grandparent = parent[p].load(std::memory_order_relaxed);
+        if (p != grandparent) {
+            parent[v].compare_exchange_weak(p, grandparent, std::memory_order_relaxed);
+        }
+        v = grandparent;
+    }
+}
+
+// Объединение без блокировок: больший корень подвешивается к меньшему через CAS,
+// при неудаче (корень успел измениться) поиск повторяется
+inline void uniteComponents(std::vector<std::atomic<int>> &parent, int u, int v) {
+    while (true) {
+        u = findComponentRoot(parent, u);
+        v = findComponentRoot(parent, v);
+        if (u == v) return;
+        if (u < v) std::swap(u, v);
+        int expected = u;
+        if (parent[u].compare_exchange_strong(expected, v, std::memory_order_relaxed)) return;
+    }
+}
+
+// Поиск компонент параллельным объединением по рёбрам, раскладка компонент по частям
+// и построение CSR каждой части
+inline GraphComponents splitComponents(const CsrGraph &graph, ThreadPool &pool) {
+    auto start = std::chrono::high_resolution_clock::now();
+    int V = graph.V;
+    int tasks = pool.size() * 4;
+
+    std::vector<std::atomic<int>> parent(V);
+    pool.parallelFor(tasks, [&](int task) {
+        for (long long v = (long long) V * task / tasks; v < (long long) V * (task + 1) / tasks; ++v) {
+            parent[v].store(v, std::memory_order_relaxed);
+        }
+    });
+    pool.parallelFor(tasks, [&](int task) {
+        for (long long u = (long long) V * task / tasks; u < (long long) V * (task + 1) / tasks; ++u) {
+            for (int v : graph.neighborsOf(u)) {
+                if (u < v) {
+                    uniteComponents(parent, u, v);
+                }
+            }
+        }
+    });
+
+    // label — корень компоненты (её наименьшая вершина), -1 для изолированных вершин
+    std::vector<int> label(V);
+    pool.parallelFor(tasks, [&](int task) {
+        for (long long v = (long long) V * task / tasks; v < (long long) V * (task + 1) / tasks; ++v) {
+            label[v] = graph.degree(v) == 0 ? -1 : findComponentRoot(parent, v);
+        }
+    });
+    std::vector<std::atomic<int>>().swap(parent);
+
+    // Корень встречается раньше остальных вершин компоненты, поэтому номер компоненты
+    // записывается на место корня и дальше берётся оттуда
+    GraphComponents components;
+    std::vector<int> componentSize;
+    std::vector<long long> componentWork;
+    for (int v = 0; v < V; ++v) {
+        if (label[v] < 0) {
+            components.isolated++;
+            continue;
+        }
+        int c = label[v] == v ? componentSize.size() : label[label[v]];
+        if (label[v] == v) {
+            componentSize.push_back(0);
+            componentWork.push_back(0);
+        }
+        label[v] = c;
+        componentSize[c]++;
+        componentWork[c] += 1 + graph.degree(v) / 2;
+    }
+    int count = componentSize.size();
+    components.components = count;
+
+    std::vector<int> order(count);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](int a, int b) { return componentWork[a] > componentWork[b]; });
+
+    long long totalWork = 0;
+    for (int c = 0; c < count; ++c) {
+        totalWork += componentWork[c];
+    }
+    long long partWork = std::max(1LL, totalWork / (pool.size() * 16));
+
+    // Части из подряд идущих компонент в порядке убывания работы; firstVertex — начало компоненты в части
+    std::vector<int> partOf(count);
+    std::vector<int> firstVertex(count);
+    std::vector<int> partSize;
+    long long current = partWork;
+    for (int c : order) {
+        if (current >= partWork) {
+            partSize.push_back(0);
+            current = 0;
+        }
+        partOf[c] = partSize.size() - 1;
+        firstVertex[c] = partSize.back();
+        partSize.back() += componentSize[c];
+        current += componentWork[c];
+    }
+
+    int parts = partSize.size();
+    components.vertices.resize(parts);
+    for (int part = 0; part < parts; ++part) {
+        components.vertices[part].resize(partSize[part]);
+    }
+    std::vector<int> localIndex(V, -1);
+    for (int v = 0; v < V; ++v) {
+        if (label[v] < 0) continue;
+        int c = label[v];
+        localIndex[v] = firstVertex[c]++;
+        components.vertices[partOf[c]][localIndex[v]] = v;
+    }
+
+    components.graphs.resize(parts);
+    pool.parallelFor(parts, [&](int part) {
+        const std::vector<int> &members = components.vertices[part];
+        CsrGraph &partGraph = components.graphs[part];
+        partGraph.V = members.size();
+        partGraph.offsets.assign(partGraph.V + 1, 0);
+        for (int i = 0; i < partGraph.V; ++i) {
+            partGraph.offsets[i + 1] = partGraph.offsets[i] + graph.degree(members[i]);
+        }
+        partGraph.neighbors.reserve(partGraph.offsets[partGraph.V]);
+        for (int u : members) {
+            for (int v : graph.neighborsOf(u)) {
+                partGraph.neighbors.push_back(localIndex[v]);
+            }
+        }
+        partGraph.E = partGraph.offsets[partGraph.V] / 2;
+        if (graph.weighted()) {
+            partGraph.weights.resize(partGraph.V);
+            for (int i = 0; i < partGraph.V; ++i) {
+                partGraph.weights[i] = graph.weight(members[i]);
+            }
+        }
+    });
+
+    components.decompositionTime = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::high_resolution_clock::now() - start).count();
+    return components;
+}
+
+// Решение каждой части последовательным алгоритмом solver(const CsrGraph&) -> вершины покрытия
+// в локальной нумерации. Компоненты независимы, поэтому решение части — это решения её компонент.
+// Части раздаются пулу по убыванию работы. solver не должен сам использовать пул:
+// parallelFor не допускает вложенных вызовов.
+template <typename Solver>
+std::vector<int> solveComponents(const GraphComponents &components, ThreadPool &pool, Solver solver) {
+    int parts = components.graphs.size();
+    std::vector<std::vector<int>> covers(parts);
+    pool.parallelFor(parts, [&](int part) {
+        for (int v : solver(components.graphs[part])) {
+            covers[part].push_back(components.vertices[part][v]);
+        }
+    });
+
+    std::vector<int> cover;
+    for (const auto &partCover : covers) {
+        cover.insert(cover.end(), partCover.begin(), partCover.end());
+    }
+    return cover;
+}
+
+#endif // GRAPH_COMPONENTS_H
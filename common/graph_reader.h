@@ -0,0 +1,289 @@
+#ifndef GRAPH_READER_H
+#define GRAPH_READER_H
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <charconv>
+
+#include "csr_graph.h"
+#include "mapped_file.h"
+#include "text_parser.h"
+#include "thread_pool.h"
+
+// Загрузка графов в стандартных форматах. Файл отображается в память и разбирается на месте.
+//   DIMACS: комментарии "c ...", заголовок "p edge V E" (или "p col V E"), рёбра "e u v" с единицы;
+//   METIS:  комментарии "% ...", заголовок "V E [fmt [ncon]]", затем V строк со списками соседей
+//           (с единицы; fmt задаёт наличие размеров, весов вершин и весов рёбер);
+//   SNAP:   комментарии "# ..." или "% ...", строки "u v [...]" с нуля, V = наибольший номер + 1.
+// Петли и повторные рёбра отбрасывает buildCsrGraph. Веса вершин можно задать отдельным файлом
+// (V целых чисел по порядку); иначе берутся веса вершин METIS, если они есть.
+
+enum class GraphFormat {
+    Dimacs,
+    Metis,
+    Snap
+};
+
+inline bool graphFormatFromFlag(const std::string &flag, GraphFormat &format) {
+    if (flag == "--dimacs") {
+        format = GraphFormat::Dimacs;
+    } else if (flag == "--metis") {
+        format = GraphFormat::Metis;
+    } else if (flag == "--snap") {
+        format = GraphFormat::Snap;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+// Разбор строки: пропуск пробелов и чтение целого; false, если чисел в строке больше нет
+inline bool readLineInteger(const char *&p, const char *end, long long &value) {
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\r')) ++p;
+    if (p == end || *p == '\n') return false;
+    auto [next, ec] = std::from_chars(p, end, value);
+    if (ec != std::errc()) return false;
+    p = next;
+    return true;
+}
+
+inline const char *lineEnd(const char *p, const char *end) {
+    const void *newline = std::memchr(p, '\n', end - p);
+    return newline ? static_cast<const char *>(newline) : end;
+}
+
+inline bool isBlankLine(const char *p, const char *end) {
+    for (; p < end; ++p) {
+        if (*p != ' ' && *p != '\t' && *p != '\r') return false;
+    }
+    return true;
+}
+
+// Разбор строк с рёбрами по блокам: lineParser(первый символ строки, конец строки, рёбра блока)
+// возвращает false при ошибке. Блоки разбираются параллельно и склеиваются по порядку.
+template <typename LineParser>
+bool parseEdgeLines(const char *data, std::size_t begin, std::size_t size, ThreadPool &pool, const std::string &path,
+                    std::vector<std::pair<int, int>> &edges, LineParser lineParser) {
+    std::vector<std::size_t> bounds = lineAlignedChunks(data + begin, size - begin, pool);
+    int chunks = bounds.size() - 1;
+    std::vector<std::vector<std::pair<int, int>>> chunkEdges(chunks);
+    std::vector<const char *> errors(chunks, nullptr);
+
+    pool.parallelFor(chunks, [&](int c) {
+        const char *p = data + begin + bounds[c];
+        const char *end = data + begin + bounds[c + 1];
+        chunkEdges[c].reserve((end - p) / 12);
+        while (p < end) {
+            const char *eol = lineEnd(p, end);
+            if (!lineParser(p, eol, chunkEdges[c])) {
+                errors[c] = p;
+                return;
+            }
+            p = eol + 1;
+        }
+    });
+
+    for (int c = 0; c < chunks; ++c) {
+        if (errors[c]) {
+            std::cout << path << ": malformed line at byte " << errors[c] - data << std::endl;
+            return false;
+        }
+    }
+    std::size_t total = edges.size();
+    for (const auto &chunk : chunkEdges) {
+        total += chunk.size();
+    }
+    edges.reserve(total);
+    for (int c = 0; c < chunks; ++c) {
+        edges.insert(edges.end(), chunkEdges[c].begin(), chunkEdges[c].end());
+        std::vector<std::pair<int, int>>().swap(chunkEdges[c]);
+    }
+    return true;
+}
+
+inline bool readDimacs(const MappedFile &file, const std::string &path, EdgeList &edgeList, ThreadPool &pool) {
+    const char *data = file.data();
+    const char *end = data + file.size();
+    const char *p = data;
+
+    // Заголовок "p edge V E" ищется последовательно
+    long long V = -1;
+    long long E = 0;
+    while (p < end && V < 0) {
+        const char *eol = lineEnd(p, end);
+        if (*p == 'p') {
+            const char *q = p + 1;
+            while (q < eol && (*q == ' ' || *q == '\t')) ++q;
+            while (q < eol && *q != ' ' && *q != '\t') ++q;
+            if (!readLineInteger(q, eol, V) || !readLineInteger(q, eol, E) || V < 0 || V >= (1LL << 31) || E < 0) {
+                std::cout << path << ": invalid problem line" << std::endl;
+                return false;
+            }
+        } else if (*p != 'c' && !isBlankLine(p, eol)) {
+            std::cout << path << ": edge before the problem line" << std::endl;
+            return false;
+        }
+        p = eol + 1;
+    }
+    if (V < 0) {
+        std::cout << path << ": missing problem line" << std::endl;
+        return false;
+    }
+
+    // E из заголовка не проверен: резерв ограничен числом рёбер, которые могут уместиться в файле
+    edgeList = EdgeList(V);
+    edgeList.edges.reserve(std::min<long long>(E, file.size() / 4));
+    std::size_t begin = std::min<std::size_t>(p - data, file.size());
+    return parseEdgeLines(data, begin, file.size(), pool, path, edgeList.edges,
+                          [V](const char *q, const char *eol, std::vector<std::pair<int, int>> &edges) {
+        if (q == eol || *q == 'c' || isBlankLine(q, eol)) return true;
+        if (*q != 'e') return false;
+        ++q;
+        long long u, v;
+        if (!readLineInteger(q, eol, u) || !readLineInteger(q, eol, v) || u < 1 || u > V || v < 1 || v > V) return false;
+        edges.emplace_back(u - 1, v - 1);
+        return true;
+    });
+}
+
+inline bool readSnap(const MappedFile &file, const std::string &path, EdgeList &edgeList, ThreadPool &pool) {
+    std::vector<std::pair<int, int>> edges;
+    bool parsed = parseEdgeLines(file.data(), 0, file.size(), pool, path, edges,
+                                 [](const char *q, const char *eol, std::vector<std::pair<int, int>> &chunkEdges) {
+        if (q == eol || *q == '#' || *q == '%' || isBlankLine(q, eol)) return true;
+        long long u, v;
+        if (!readLineInteger(q, eol, u) || !readLineInteger(q, eol, v) || u < 0 || v < 0 || u >= (1LL << 31) - 1 || v >= (1LL << 31) - 1) {
+            return false;
+        }
+        chunkEdges.emplace_back(u, v);
+        return true;
+    });
+    if (!parsed) return false;
+
+    int V = 0;
+    for (const auto &[u, v] : edges) {
+        V = std::max(V, std::max(u, v) + 1);
+    }
+    edgeList = EdgeList(V);
+    edgeList.edges = std::move(edges);
+    return true;
+}
+
+// METIS разбирается последовательно: номер вершины — номер строки
+inline bool readMetis(const MappedFile &file, const std::string &path, EdgeList &edgeList) {
+    const char *data = file.data();
+    const char *end = data + file.size();
+    const char *p = data;
+
+    auto nextLine = [&](const char *&first, const char *&last) {
+        while (p < end && *p == '%') {
+            p = lineEnd(p, end) + 1;
+        }
+        if (p >= end) return false;
+        first = p;
+        last = lineEnd(p, end);
+        p = last + 1;
+        return true;
+    };
+
+    const char *first;
+    const char *last;
+    long long V, E, format = 0, constraints = 1;
+    if (!nextLine(first, last) || !readLineInteger(first, last, V) || !readLineInteger(first, last, E) || V < 0 || V >= (1LL << 31) || E < 0) {
+        std::cout << path << ": invalid METIS header" << std::endl;
+        return false;
+    }
+    // fmt — до трёх цифр: размеры вершин, веса вершин, веса рёбер
+    readLineInteger(first, last, format);
+    bool hasSizes = format / 100 % 10;
+    bool hasVertexWeights = format / 10 % 10;
+    bool hasEdgeWeights = format % 10;
+    readLineInteger(first, last, constraints);
+
+    edgeList = EdgeList(V);
+    edgeList.edges.reserve(std::min<long long>(E, file.size() / 4));
+    for (long long u = 0; u < V; ++u) {
+        if (!nextLine(first, last)) {
+            std::cout << path << ": expected " << V << " adjacency lines, got " << u << std::endl;
+            return false;
+        }
+        long long value;
+        if (hasSizes && !readLineInteger(first, last, value)) {
+            std::cout << path << ": missing size of vertex " << u + 1 << std::endl;
+            return false;
+        }
+        for (long long k = 0; hasVertexWeights && k < constraints; ++k) {
+            if (!readLineInteger(first, last, value)) {
+                std::cout << path << ": missing weight of vertex " << u + 1 << std::endl;
+                return false;
+            }
+            if (k == 0) {
+                edgeList.setWeight(u, value);
+            }
+        }
+        long long v;
+        while (readLineInteger(first, last, v)) {
+            if (v < 1 || v > V || (hasEdgeWeights && !readLineInteger(first, last, value))) {
+                std::cout << path << ": invalid neighbor list of vertex " << u + 1 << std::endl;
+                return false;
+            }
+            // Каждое ребро перечислено у обоих концов, берётся один раз
+            if (u <= v - 1) {
+                edgeList.addEdge(u, v - 1);
+            }
+        }
+        if (!isBlankLine(first, last)) {
+            std::cout << path << ": unexpected character in the line of vertex " << u + 1 << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+// Веса вершин из отдельного файла: V целых чисел
+inline bool readVertexWeights(const std::string &path, EdgeList &edgeList, ThreadPool &pool) {
+    std::vector<int> values;
+    if (!parseIntegerFile(path, values, pool)) {
+        return false;
+    }
+    if (values.size() != (std::size_t) edgeList.V) {
+        std::cout << path << ": expected " << edgeList.V << " vertex weights, got " << values.size() << std::endl;
+        return false;
+    }
+    for (int v = 0; v < edgeList.V; ++v) {
+        edgeList.setWeight(v, values[v]);
+    }
+    return true;
+}
+
+// Загрузка графа; weightsPath может быть пустым
+inline bool loadGraphFile(const std::string &path, GraphFormat format, const std::string &weightsPath,
+                          CsrGraph &graph, ThreadPool &pool) {
+    MappedFile file;
+    if (!file.open(path)) {
+        std::cout << "Cannot open " << path << std::endl;
+        return false;
+    }
+
+    EdgeList edgeList(0);
+    bool parsed = format == GraphFormat::Dimacs ? readDimacs(file, path, edgeList, pool)
+                : format == GraphFormat::Snap ? readSnap(file, path, edgeList, pool)
+                : readMetis(file, path, edgeList);
+    if (!parsed) return false;
+    file.close();
+
+    if (!weightsPath.empty() && !readVertexWeights(weightsPath, edgeList, pool)) {
+        return false;
+    }
+    CsrBuildStats stats;
+    graph = buildCsrGraph(edgeList, pool, &stats);
+
+    std::cout << "Loaded " << graph.V << " vertices, " << graph.E << " edges (dropped " << stats.selfLoops
+              << " self-loops, " << stats.duplicateEdges << " duplicate edges)" << std::endl;
+    return true;
+}
+
+#endif // GRAPH_READER_H
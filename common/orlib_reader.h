@@ -0,0 +1,131 @@
+#ifndef ORLIB_READER_H
+#define ORLIB_READER_H
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "set_system.h"
+#include "text_parser.h"
+#include "thread_pool.h"
+
+// Чтение экземпляров покрытия множеств из OR-Library. Строки — элементы универсума, столбцы — множества.
+// Формат scp (scp4x–scpnrhx): "m n", n стоимостей столбцов, затем для каждой строки число
+// покрывающих её столбцов и их номера (с единицы).
+// Формат rail (rail507–rail4872): "m n", затем для каждого столбца стоимость, число строк и их номера (с единицы).
+// Файл разбирается один раз; для scp строки раскладываются по столбцам подсчётом.
+
+inline bool setSystemFromScp(const std::vector<int> &values, SetSystem &sets, int &n) {
+    if (values.size() < 2 || values[0] < 0 || values[1] < 0 || values.size() - 2 < (std::size_t) values[1]) {
+        std::cout << "Invalid scp header or costs" << std::endl;
+        return false;
+    }
+    int rows = values[0];
+    int columns = values[1];
+
+    // Проход по строкам: проверка и подсчёт размеров столбцов
+    std::vector<int> offsets(columns + 1, 0);
+    std::size_t position = 2 + columns;
+    for (int row = 0; row < rows; ++row) {
+        if (position >= values.size() || values[position] < 0 || values.size() - position - 1 < (std::size_t) values[position]) {
+            std::cout << "Row " << row + 1 << " is truncated" << std::endl;
+            return false;
+        }
+        int count = values[position++];
+        for (int k = 0; k < count; ++k) {
+            int column = values[position++];
+            if (column < 1 || column > columns) {
+                std::cout << "Row " << row + 1 << " references column " << column << std::endl;
+                return false;
+            }
+            offsets[column]++;
+        }
+    }
+    for (int j = 0; j < columns; ++j) {
+        offsets[j + 1] += offsets[j];
+    }
+
+    // Раскладка строк по столбцам; строки идут по возрастанию, поэтому столбцы остаются отсортированными
+    std::vector<int> elements(offsets[columns]);
+    std::vector<int> fillPos(offsets.begin(), offsets.end() - 1);
+    position = 2 + columns;
+    for (int row = 0; row < rows; ++row) {
+        int count = values[position++];
+        for (int k = 0; k < count; ++k) {
+            elements[fillPos[values[position++] - 1]++] = row;
+        }
+    }
+
+    // Строка могла перечислить столбец дважды: повторы удаляются сдвигом на месте
+    int write = 0;
+    for (int j = 0; j < columns; ++j) {
+        int begin = offsets[j];
+        offsets[j] = write;
+        for (int k = begin; k < offsets[j + 1]; ++k) {
+            if (write == offsets[j] || elements[write - 1] != elements[k]) {
+                elements[write++] = elements[k];
+            }
+        }
+    }
+    offsets[columns] = write;
+    elements.resize(write);
+
+    sets = SetSystem();
+    sets.offsets = std::move(offsets);
+    sets.elements = std::move(elements);
+    sets.costs.assign(values.begin() + 2, values.begin() + 2 + columns);
+    n = rows;
+    return true;
+}
+
+inline bool setSystemFromRail(const std::vector<int> &values, SetSystem &sets, int &n) {
+    if (values.size() < 2 || values[0] < 0 || values[1] < 0) {
+        std::cout << "Invalid rail header" << std::endl;
+        return false;
+    }
+    int rows = values[0];
+    int columns = values[1];
+
+    sets = SetSystem();
+    sets.reserve(columns, values.size() - 2);
+    sets.costs.reserve(columns);
+    std::size_t position = 2;
+    for (int j = 0; j < columns; ++j) {
+        if (values.size() - position < 2 || values[position + 1] < 0 ||
+            values.size() - position - 2 < (std::size_t) values[position + 1]) {
+            std::cout << "Column " << j + 1 << " is truncated" << std::endl;
+            return false;
+        }
+        sets.costs.push_back(values[position]);
+        int count = values[position + 1];
+        position += 2;
+        for (int k = 0; k < count; ++k) {
+            int row = values[position++];
+            if (row < 1 || row > rows) {
+                std::cout << "Column " << j + 1 << " references row " << row << std::endl;
+                return false;
+            }
+            sets.elements.push_back(row - 1);
+        }
+        sets.finishSet();
+    }
+    n = rows;
+    return true;
+}
+
+// Формат определяется по имени файла: rail*, иначе scp
+inline bool isRailInstance(const std::string &path) {
+    std::size_t slash = path.find_last_of("/\\");
+    std::string name = slash == std::string::npos ? path : path.substr(slash + 1);
+    return name.rfind("rail", 0) == 0;
+}
+
+inline bool loadOrLibrary(const std::string &path, SetSystem &sets, int &n, ThreadPool &pool) {
+    std::vector<int> values;
+    if (!parseIntegerFile(path, values, pool)) {
+        return false;
+    }
+    return isRailInstance(path) ? setSystemFromRail(values, sets, n) : setSystemFromScp(values, sets, n);
+}
+
+#endif // ORLIB_READER_H
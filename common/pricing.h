@@ -0,0 +1,615 @@
+#ifndef PRICING_H
+#define PRICING_H
+
+#include <iostream>
+#include <vector>
+#include <unordered_set>
+#include <unordered_map>
+#include <deque>
+#include <string>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+
+#include "csr_graph.h"
+#include "edge_stream.h"
+#include "graph_components.h"
+#include "text_parser.h"
+#include "thread_pool.h"
+
+// Метод оценки (primal-dual) для взвешенного вершинного покрытия: исходный, за один проход,
+// параллельный, по раундам, потоковый по файлу рёбер и динамический при вставке и удалении рёбер.
+// Общие для pricing_method и pricing_method_test.
+
+inline bool isTight(const std::vector<int>& prices, const CsrGraph& graph, int v) {
+    int sumPrices = 0;
+    for (int u : graph.neighborsOf(v)) {
+        sumPrices += prices[u];
+    }
+    return sumPrices >= graph.weight(v);
+}
+
+inline std::vector<int> pricingMethod(const CsrGraph& graph) {
+    int V = graph.V;
+    std::vector<int> prices(V, 0); // начальные цены
+    std::unordered_set<int> vertexCover;
+
+    while (true) {
+        bool found = false;
+
+        // Ищем ребро, у которого ни одна из вершин не является плотной
+        for (int u = 0; u < V; ++u) {
+            for (int v : graph.neighborsOf(u)) {
+                if (!isTight(prices, graph, u) && !isTight(prices, graph, v)) {
+                    // Увеличиваем цену ребра (u, v)
+                    int maxIncrease = std::min(graph.weight(u) - prices[u], graph.weight(v) - prices[v]);
+                    prices[u] += maxIncrease;
+                    prices[v] += maxIncrease;
+                    found = true;
+                }
+            }
+        }
+
+        // Если больше нет неплотных ребер, выходим из цикла
+        if (!found) break;
+
+        // Добавляем все плотные вершины в покрытие
+        for (int i = 0; i < V; ++i) {
+            if (isTight(prices, graph, i)) {
+                vertexCover.insert(i);
+            }
+        }
+    }
+
+    return std::vector<int>(vertexCover.begin(), vertexCover.end());
+}
+
+// Метод оценки за один проход O(V + E): хранится остаточный вес вершины (вес минус сумма цен
+// инцидентных рёбер). Каждое ребро просматривается один раз, и его цена поднимается на меньший
+// из остатков концов; вершина становится плотной, когда остаток доходит до нуля, и остальные её
+// рёбра уже покрыты. Сумма цен рёбер (dualValue) — нижняя оценка веса оптимального покрытия,
+// вес найденного покрытия не больше удвоенной суммы.
+inline std::vector<int> residualPricingMethod(const CsrGraph& graph, long long* dualValue = nullptr) {
+    int V = graph.V;
+    std::vector<int> residual(V);
+    for (int v = 0; v < V; ++v) {
+        residual[v] = graph.weight(v);
+    }
+
+    long long dual = 0;
+    for (int u = 0; u < V; ++u) {
+        for (int v : graph.neighborsOf(u)) {
+            if (residual[u] <= 0) break;
+            if (u < v && residual[v] > 0) {
+                int increase = std::min(residual[u], residual[v]);
+                residual[u] -= increase;
+                residual[v] -= increase;
+                dual += increase;
+            }
+        }
+    }
+
+    std::vector<int> vertexCover;
+    for (int v = 0; v < V; ++v) {
+        if (residual[v] <= 0 && graph.degree(v) > 0) {
+            vertexCover.push_back(v);
+        }
+    }
+    if (dualValue) {
+        *dualValue = dual;
+    }
+    return vertexCover;
+}
+
+// Подъём цены ребра (u, v) без блокировок; возвращает, на сколько поднята цена.
+// Сначала CAS снимает меньший остаток d у конца с большим остатком — тот не становится плотным,
+// кроме случая равных остатков. Затем у второго конца снимается не больше d (сколько у него осталось
+// к этому моменту), а излишек возвращается первому. Остатки не уходят ниже нуля, поэтому цены
+// остаются допустимыми при любом чередовании потоков.
+inline int raiseEdgePrice(std::vector<std::atomic<int>>& residual, int u, int v) {
+    while (true) {
+        int ru = residual[u].load(std::memory_order_relaxed);
+        int rv = residual[v].load(std::memory_order_relaxed);
+        if (ru <= 0 || rv <= 0) return 0;
+        int larger = ru >= rv ? u : v;
+        int smaller = ru >= rv ? v : u;
+        int expected = std::max(ru, rv);
+        int increase = std::min(ru, rv);
+        if (!residual[larger].compare_exchange_weak(expected, expected - increase, std::memory_order_relaxed)) continue;
+
+        int current = residual[smaller].load(std::memory_order_relaxed);
+        int taken = std::min(increase, current);
+        while (taken > 0 && !residual[smaller].compare_exchange_weak(current, current - taken, std::memory_order_relaxed)) {
+            taken = std::min(increase, current);
+        }
+        taken = std::max(taken, 0);
+        if (taken < increase) {
+            residual[larger].fetch_add(increase - taken, std::memory_order_relaxed);
+        }
+        return taken;
+    }
+}
+
+// Параллельный метод оценки: рёбра делятся между задачами диапазонами вершин с равным числом
+// записей соседей, остатки обновляются через CAS (raiseEdgePrice), ребро пропускается, как только
+// один из концов плотный. Возврат излишка может ненадолго сделать вершину плотной, и чужое ребро
+// будет пропущено зря, поэтому после параллельного прохода рёбра без плотного конца
+// добираются последовательно тем же однопроходным правилом. Итог — допустимые цены рёбер
+// (dualValue — их сумма) и покрытие плотными вершинами весом не больше 2 * dualValue.
+inline std::vector<int> parallelPricingMethod(const CsrGraph& graph, ThreadPool& pool, long long* dualValue = nullptr) {
+    int V = graph.V;
+    int tasks = pool.size() * 4;
+    const long long *offsets = graph.offsetData();
+
+    std::vector<std::atomic<int>> residual(V);
+    pool.parallelFor(tasks, [&](int task) {
+        for (long long v = (long long) V * task / tasks; v < (long long) V * (task + 1) / tasks; ++v) {
+            residual[v].store(graph.weight(v), std::memory_order_relaxed);
+        }
+    });
+
+    std::vector<int> taskFirst(tasks + 1, V);
+    for (int task = 0; task < tasks; ++task) {
+        taskFirst[task] = std::lower_bound(offsets, offsets + V, offsets[V] * task / tasks) - offsets;
+    }
+    std::vector<long long> taskDual(tasks, 0);
+    pool.parallelFor(tasks, [&](int task) {
+        for (int u = taskFirst[task]; u < taskFirst[task + 1]; ++u) {
+            for (int v : graph.neighborsOf(u)) {
+                if (residual[u].load(std::memory_order_relaxed) <= 0) break;
+                if (u < v) {
+                    taskDual[task] += raiseEdgePrice(residual, u, v);
+                }
+            }
+        }
+    });
+
+    // Добор рёбер без плотного конца: поиск параллельный, подъём цен последовательный
+    std::vector<std::vector<std::pair<int, int>>> uncovered(tasks);
+    pool.parallelFor(tasks, [&](int task) {
+        for (int u = taskFirst[task]; u < taskFirst[task + 1]; ++u) {
+            if (residual[u].load(std::memory_order_relaxed) <= 0) continue;
+            for (int v : graph.neighborsOf(u)) {
+                if (u < v && residual[v].load(std::memory_order_relaxed) > 0) {
+                    uncovered[task].emplace_back(u, v);
+                }
+            }
+        }
+    });
+    long long dual = 0;
+    for (int task = 0; task < tasks; ++task) {
+        dual += taskDual[task];
+        for (const auto &[u, v] : uncovered[task]) {
+            dual += raiseEdgePrice(residual, u, v);
+        }
+    }
+
+    std::vector<int> vertexCover;
+    for (int v = 0; v < V; ++v) {
+        if (residual[v].load(std::memory_order_relaxed) <= 0 && graph.degree(v) > 0) {
+            vertexCover.push_back(v);
+        }
+    }
+    if (dualValue) {
+        *dualValue = dual;
+    }
+    return vertexCover;
+}
+
+// Ход метода оценки по раундам: число раундов, время и число активных рёбер в каждом раунде
+struct RoundPricingStats {
+    int rounds = 0;
+    std::vector<long long> roundTime; // мкс
+    std::vector<long long> activeEdges;
+    double dualValue = 0;
+};
+
+// Метод оценки по синхронным раундам (Khuller–Vishkin–Young). Активное ребро — ребро без вершин
+// в покрытии. В раунде каждая вершина делит свой остаток поровну между активными рёбрами, и цена
+// ребра поднимается на меньшую из долей концов, так что остаток не уходит ниже нуля. Вершина
+// с остатком не больше epsilon * вес входит в покрытие. Вершина с наименьшей долей отдаёт весь
+// остаток, поэтому каждый раунд кто-то становится плотным; обычно раундов O(log V).
+// Вес покрытия не больше 2 / (1 - epsilon) суммы цен рёбер, 0 <= epsilon < 1. Каждый раунд — три параллельных
+// прохода по CSR: активные степени и доли, подъём цен, выбор плотных вершин.
+inline std::vector<int> roundPricingMethod(const CsrGraph& graph, ThreadPool& pool, double epsilon, RoundPricingStats* stats = nullptr) {
+    int V = graph.V;
+    int tasks = pool.size() * 4;
+    const long long *offsets = graph.offsetData();
+
+    std::vector<int> taskFirst(tasks + 1, V);
+    for (int task = 0; task < tasks; ++task) {
+        taskFirst[task] = std::lower_bound(offsets, offsets + V, offsets[V] * task / tasks) - offsets;
+    }
+
+    std::vector<double> residual(V);
+    std::vector<double> share(V);
+    std::vector<int> activeDegree(V);
+    std::vector<char> inCover(V, 0);
+    for (int v = 0; v < V; ++v) {
+        residual[v] = graph.weight(v);
+    }
+    std::vector<long long> taskActive(tasks);
+    std::vector<double> taskDual(tasks);
+    RoundPricingStats roundStats;
+
+    while (true) {
+        auto roundStart = std::chrono::high_resolution_clock::now();
+
+        // Доля вершины — остаток, делённый на число активных рёбер
+        pool.parallelFor(tasks, [&](int task) {
+            taskActive[task] = 0;
+            for (int v = taskFirst[task]; v < taskFirst[task + 1]; ++v) {
+                int degree = 0;
+                if (!inCover[v]) {
+                    for (int u : graph.neighborsOf(v)) {
+                        degree += !inCover[u];
+                    }
+                }
+                activeDegree[v] = degree;
+                share[v] = degree > 0 ? residual[v] / degree : 0;
+                taskActive[task] += degree;
+            }
+        });
+        long long active = 0;
+        for (int task = 0; task < tasks; ++task) {
+            active += taskActive[task];
+        }
+        if (active == 0) break;
+
+        // Цена ребра одинакова с обеих сторон, поэтому каждая вершина вычитает свою сумму сама
+        pool.parallelFor(tasks, [&](int task) {
+            taskDual[task] = 0;
+            for (int v = taskFirst[task]; v < taskFirst[task + 1]; ++v) {
+                if (inCover[v]) continue;
+                double decrease = 0;
+                for (int u : graph.neighborsOf(v)) {
+                    if (inCover[u]) continue;
+                    double price = std::min(share[v], share[u]);
+                    decrease += price;
+                    if (v < u) {
+                        taskDual[task] += price;
+                    }
+                }
+                // Вершина с наименьшей долей отдаёт весь остаток; погрешность округления не должна его оставлять
+                residual[v] = decrease >= residual[v] * (1 - 1e-12) ? 0 : residual[v] - decrease;
+            }
+        });
+
+        pool.parallelFor(tasks, [&](int task) {
+            for (int v = taskFirst[task]; v < taskFirst[task + 1]; ++v) {
+                if (!inCover[v] && activeDegree[v] > 0 && residual[v] <= epsilon * graph.weight(v)) {
+                    inCover[v] = 1;
+                }
+            }
+        });
+
+        for (int task = 0; task < tasks; ++task) {
+            roundStats.dualValue += taskDual[task];
+        }
+        roundStats.rounds++;
+        roundStats.activeEdges.push_back(active / 2);
+        roundStats.roundTime.push_back(std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::high_resolution_clock::now() - roundStart).count());
+    }
+
+    std::vector<int> vertexCover;
+    for (int v = 0; v < V; ++v) {
+        if (inCover[v]) {
+            vertexCover.push_back(v);
+        }
+    }
+    if (stats) {
+        *stats = std::move(roundStats);
+    }
+    return vertexCover;
+}
+
+// Потоковый метод оценки: рёбра читаются из файла или канала по одному и сразу проходят шаг
+// однопроходного метода (подъём цены на меньший из остатков концов). В памяти только остатки
+// и отметки вершин — O(V), сами рёбра не хранятся. Веса берутся из файла весов, иначе равны 1,
+// и для SNAP массивы растут по наибольшему номеру вершины. Петли пропускаются, как при построении
+// графа. Покрытие — плотные вершины, у которых было хотя бы одно ребро.
+inline bool streamingPricingMethod(const std::string& path, GraphFormat format, const std::string& weightsPath, ThreadPool& pool,
+                                   std::vector<int>& vertexCover, long long* dualValue = nullptr, long long* edgeCount = nullptr) {
+    std::vector<int> residual;
+    bool fixedSize = !weightsPath.empty();
+    if (fixedSize && !parseIntegerFile(weightsPath, residual, pool)) {
+        return false;
+    }
+    std::vector<char> touched(residual.size(), 0);
+
+    long long dual = 0;
+    long long edges = 0;
+    bool streamed = streamEdges(path, format, [&](long long V) {
+        if (fixedSize && V != (long long) residual.size()) {
+            std::cout << weightsPath << ": expected " << V << " vertex weights, got " << residual.size() << std::endl;
+            return false;
+        }
+        residual.resize(V, 1);
+        touched.resize(V, 0);
+        return true;
+    }, [&](long long u, long long v) {
+        long long last = std::max(u, v);
+        if (last >= (long long) residual.size()) {
+            if (fixedSize) {
+                std::cout << path << ": vertex " << last << " has no weight" << std::endl;
+                return false;
+            }
+            residual.resize(last + 1, 1);
+            touched.resize(last + 1, 0);
+        }
+        ++edges;
+        if (u == v) return true;
+        touched[u] = touched[v] = 1;
+        if (residual[u] > 0 && residual[v] > 0) {
+            int increase = std::min(residual[u], residual[v]);
+            residual[u] -= increase;
+            residual[v] -= increase;
+            dual += increase;
+        }
+        return true;
+    });
+    if (!streamed) return false;
+
+    vertexCover.clear();
+    for (std::size_t v = 0; v < residual.size(); ++v) {
+        if (touched[v] && residual[v] <= 0) {
+            vertexCover.push_back(v);
+        }
+    }
+    if (dualValue) {
+        *dualValue = dual;
+    }
+    if (edgeCount) {
+        *edgeCount = edges;
+    }
+    return true;
+}
+
+// Изменение графа для пакетного обновления
+struct EdgeUpdate {
+    int u;
+    int v;
+    bool insert;
+};
+
+// Метод оценки на меняющемся графе: цены рёбер, остатки весов и плотные вершины сохраняются между
+// обновлениями. Инвариант — у каждого ребра есть плотный конец, поэтому плотные вершины с рёбрами
+// образуют покрытие весом не больше 2 * dualValue(). Вставка сразу поднимает цену нового ребра;
+// удаление возвращает цену концам, и заново оцениваются только рёбра этих концов (у остальных
+// рёбер остатки концов могли только уменьшиться). Обновление стоит O(степени затронутых вершин).
+// Вершины без заданного веса получают вес 1, их число растёт по наибольшему номеру.
+class DynamicPricing {
+public:
+    explicit DynamicPricing(const std::vector<int>& weights = {}) {
+        addVertices(weights.size());
+        for (std::size_t v = 0; v < weights.size(); ++v) {
+            weight[v] = residual[v] = weights[v];
+        }
+    }
+
+    // false, если ребро уже есть или это петля
+    bool insertEdge(int u, int v) {
+        if (!linkEdge(u, v)) return false;
+        raisePrice(u, v);
+        updateCover(u);
+        updateCover(v);
+        return true;
+    }
+
+    // false, если ребра нет
+    bool deleteEdge(int u, int v) {
+        if (!unlinkEdge(u, v)) return false;
+        repriceAround(u);
+        repriceAround(v);
+        updateCover(u);
+        updateCover(v);
+        return true;
+    }
+
+    // Пакет применяется по порядку, но рёбра вокруг каждой затронутой вершины оцениваются один раз
+    // после всех изменений; возвращает число применённых изменений
+    int applyBatch(const std::vector<EdgeUpdate>& updates) {
+        ++currentStamp;
+        std::vector<int> touched;
+        int applied = 0;
+        auto touch = [&](int v) {
+            if (stamp[v] != currentStamp) {
+                stamp[v] = currentStamp;
+                touched.push_back(v);
+            }
+        };
+        for (const EdgeUpdate &update : updates) {
+            if (update.insert ? linkEdge(update.u, update.v) : unlinkEdge(update.u, update.v)) {
+                applied++;
+                touch(update.u);
+                touch(update.v);
+            }
+        }
+        for (int v : touched) {
+            repriceAround(v);
+        }
+        for (int v : touched) {
+            updateCover(v);
+        }
+        return applied;
+    }
+
+    std::vector<int> cover() const {
+        std::vector<int> vertexCover;
+        for (int v = 0; v < (int) weight.size(); ++v) {
+            if (covered[v]) {
+                vertexCover.push_back(v);
+            }
+        }
+        return vertexCover;
+    }
+
+    int vertexCount() const { return weight.size(); }
+    long long edgeCount() const { return edges; }
+    long long coverWeight() const { return weightOfCover; }
+    long long dualValue() const { return dual; }
+
+private:
+    void addVertices(std::size_t count) {
+        if (count <= weight.size()) return;
+        weight.resize(count, 1);
+        residual.resize(count, 1);
+        prices.resize(count);
+        covered.resize(count, 0);
+        stamp.resize(count, 0);
+    }
+
+    bool linkEdge(int u, int v) {
+        if (u == v) return false;
+        addVertices(std::max(u, v) + 1);
+        if (!prices[u].emplace(v, 0).second) return false;
+        prices[v].emplace(u, 0);
+        edges++;
+        return true;
+    }
+
+    // Удаление ребра с возвратом его цены концам
+    bool unlinkEdge(int u, int v) {
+        if (std::max(u, v) >= (int) weight.size()) return false;
+        auto it = prices[u].find(v);
+        if (it == prices[u].end()) return false;
+        int price = it->second;
+        prices[u].erase(it);
+        prices[v].erase(u);
+        residual[u] += price;
+        residual[v] += price;
+        dual -= price;
+        edges--;
+        return true;
+    }
+
+    void raisePrice(int u, int v) {
+        if (residual[u] <= 0 || residual[v] <= 0) return;
+        int increase = std::min(residual[u], residual[v]);
+        prices[u][v] += increase;
+        prices[v][u] += increase;
+        residual[u] -= increase;
+        residual[v] -= increase;
+        dual += increase;
+    }
+
+    void repriceAround(int u) {
+        for (auto &[v, price] : prices[u]) {
+            if (residual[u] <= 0) break;
+            if (residual[v] > 0) {
+                int increase = std::min(residual[u], residual[v]);
+                price += increase;
+                prices[v][u] += increase;
+                residual[u] -= increase;
+                residual[v] -= increase;
+                dual += increase;
+                updateCover(v);
+            }
+        }
+    }
+
+    // В покрытии — плотные вершины, у которых есть рёбра
+    void updateCover(int v) {
+        bool shouldCover = residual[v] <= 0 && !prices[v].empty();
+        if (shouldCover != (bool) covered[v]) {
+            covered[v] = shouldCover;
+            weightOfCover += shouldCover ? weight[v] : -weight[v];
+        }
+    }
+
+    std::vector<int> weight;
+    std::vector<int> residual;
+    std::vector<std::unordered_map<int, int>> prices; // цены рёбер у обоих концов
+    std::vector<char> covered;
+    std::vector<int> stamp;
+    int currentStamp = 0;
+    long long edges = 0;
+    long long dual = 0;
+    long long weightOfCover = 0;
+};
+
+// Итоги воспроизведения потока рёбер
+struct ReplayStats {
+    long long lines = 0;
+    long long batches = 0;
+    long long updates = 0;
+    long long updateTime = 0; // мкс, только применение пакетов
+};
+
+// Воспроизведение потока рёбер с метками времени (строки "u v t" с нуля, t не убывает) в скользящем
+// окне длины window (0 — рёбра не устаревают). Рёбра с одной меткой вставляются одним пакетом,
+// вместе с ним удаляются рёбра с меткой не больше t - window. Копии ребра в окне считаются,
+// из графа ребро уходит вместе с последней копией.
+inline bool replayEdgeStream(const std::string& path, long long window, DynamicPricing& pricing, ReplayStats& stats) {
+    struct TimedEdge {
+        int u;
+        int v;
+        long long time;
+    };
+    std::deque<TimedEdge> alive;
+    std::unordered_map<long long, int> copies;
+    std::vector<EdgeUpdate> batch;
+    long long batchTime = 0;
+    auto edgeKey = [](int u, int v) { return (long long) std::min(u, v) << 32 | std::max(u, v); };
+
+    auto flush = [&]() {
+        while (window > 0 && !alive.empty() && alive.front().time <= batchTime - window) {
+            TimedEdge edge = alive.front();
+            alive.pop_front();
+            auto it = copies.find(edgeKey(edge.u, edge.v));
+            if (--it->second == 0) {
+                copies.erase(it);
+                batch.push_back({edge.u, edge.v, false});
+            }
+        }
+        auto start = std::chrono::high_resolution_clock::now();
+        stats.updates += pricing.applyBatch(batch);
+        stats.updateTime += std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::high_resolution_clock::now() - start).count();
+        stats.batches++;
+        batch.clear();
+    };
+
+    bool parsed = forEachLine(path, [&](const char *p, const char *eol) {
+        ++stats.lines;
+        if (p == eol || *p == '#' || *p == '%' || isBlankLine(p, eol)) return true;
+        long long u, v, time;
+        if (!readLineInteger(p, eol, u) || !readLineInteger(p, eol, v) || !readLineInteger(p, eol, time) ||
+            u < 0 || v < 0 || u >= (1LL << 31) - 1 || v >= (1LL << 31) - 1) {
+            std::cout << path << ": malformed line " << stats.lines << std::endl;
+            return false;
+        }
+        if (!alive.empty() && time < batchTime) {
+            std::cout << path << ": timestamps decrease at line " << stats.lines << std::endl;
+            return false;
+        }
+        if (!alive.empty() && time != batchTime) {
+            flush();
+        }
+        batchTime = time;
+        if (u == v) return true;
+        alive.push_back({(int) u, (int) v, time});
+        if (copies[edgeKey(u, v)]++ == 0) {
+            batch.push_back({(int) u, (int) v, true});
+        }
+        return true;
+    });
+    if (!parsed) return false;
+    if (!batch.empty()) {
+        flush();
+    }
+    return true;
+}
+
+// Метод оценки по компонентам связности: цены рёбер разных компонент не влияют друг на друга,
+// поэтому компоненты решаются независимо на пуле потоков с тем же результатом. Сводка разбиения — в stats.
+inline std::vector<int> componentPricingMethod(const CsrGraph& graph, ThreadPool& pool, ComponentStats *stats = nullptr) {
+    GraphComponents components = splitComponents(graph, pool);
+    if (stats) {
+        *stats = componentStats(components);
+    }
+    return solveComponents(components, pool, pricingMethod);
+}
+
+#endif // PRICING_H
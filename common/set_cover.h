@@ -0,0 +1,467 @@
+#ifndef SET_COVER_H
+#define SET_COVER_H
+
+#include <iostream>
+#include <vector>
+#include <unordered_set>
+#include <algorithm>
+#include <queue>
+#include <utility>
+#include <tuple>
+#include <functional>
+#include <fstream>
+#include <string>
+#include <chrono>
+
+#include "set_system.h"
+#include "bitset_ops.h"
+#include "thread_pool.h"
+
+// Жадные алгоритмы покрытия множеств на SetSystem: исходный, ленивый, на корзинах, на битовых картах,
+// параллельный, взвешенный и потоковый многопроходный. Общие для greedy_set и greedy_set_test.
+
+// Жадный алгоритм покрытия множеств: на каждом шаге полный пересчёт выигрыша всех множеств
+inline bool greedySetCover(const SetSystem &sets, int n, std::vector<int> &cover) {
+    int m = sets.size();
+    std::unordered_set<int> covered;
+
+    while (covered.size() < n) {
+        int bestSet = -1;
+        int maxCover = 0;
+        // Поиск множества, покрывающего наибольшее количество непокрытых элементов
+        for (int i = 0; i < m; ++i) {
+            int currentCover = 0;
+            for (int element : sets[i]) {
+                if (covered.find(element) == covered.end()) {
+                    currentCover++;
+                }
+            }
+            if (currentCover > maxCover) {
+                maxCover = currentCover;
+                bestSet = i;
+            }
+        }
+
+        // Если невозможно покрыть все элементы
+        if (bestSet == -1) {
+            return false;
+        }
+
+        // Добавление выбранного множества в покрытие
+        cover.push_back(bestSet);
+        for (int element : sets[bestSet]) {
+            covered.insert(element);
+        }
+    }
+
+    return true;
+}
+
+// Ленивый жадный алгоритм: в куче хранится последний известный выигрыш каждого множества.
+// Выигрыш только убывает, поэтому пересчитывается лишь вершина кучи; если он не изменился,
+// множество лучшее. При равенстве выигрыша выбирается меньший индекс, как в greedySetCover.
+inline bool lazyGreedySetCover(const SetSystem &sets, int n, std::vector<int> &cover) {
+    int m = sets.size();
+    std::unordered_set<int> covered;
+
+    // Пара (выигрыш, -индекс): наибольший выигрыш, затем наименьший индекс
+    std::priority_queue<std::pair<int, int>> heap;
+    for (int i = 0; i < m; ++i) {
+        if (!sets[i].empty()) {
+            heap.emplace(sets[i].size(), -i);
+        }
+    }
+
+    while (covered.size() < (std::size_t) n) {
+        int bestSet = -1;
+        while (!heap.empty()) {
+            auto [staleGain, negIndex] = heap.top();
+            heap.pop();
+            int i = -negIndex;
+
+            int currentCover = 0;
+            for (int element : sets[i]) {
+                if (covered.find(element) == covered.end()) {
+                    currentCover++;
+                }
+            }
+
+            if (currentCover == staleGain) {
+                bestSet = i;
+                break;
+            }
+            if (currentCover > 0) {
+                heap.emplace(currentCover, negIndex);
+            }
+        }
+
+        if (bestSet == -1) {
+            return false;
+        }
+
+        cover.push_back(bestSet);
+        for (int element : sets[bestSet]) {
+            covered.insert(element);
+        }
+    }
+
+    return true;
+}
+
+// Жадный алгоритм на корзинах: множества лежат в корзинах по текущему выигрышу, а обратный индекс
+// элемент -> множества уменьшает выигрыш всех множеств элемента при его покрытии.
+// Общее время O(n + m + суммарный размер множеств). Устаревшие записи в корзинах пропускаются при извлечении.
+inline bool bucketGreedySetCover(const SetSystem &sets, int n, std::vector<int> &cover) {
+    int m = sets.size();
+    std::vector<int> gain(m, 0);
+    std::vector<int> elementOffsets(n + 1, 0);
+
+    // Обратный индекс: для каждого элемента список содержащих его множеств
+    for (int i = 0; i < m; ++i) {
+        for (int element : sets[i]) {
+            if (element >= 0 && element < n) {
+                gain[i]++;
+                elementOffsets[element + 1]++;
+            }
+        }
+    }
+    for (int e = 0; e < n; ++e) {
+        elementOffsets[e + 1] += elementOffsets[e];
+    }
+    std::vector<int> elementSets(elementOffsets[n]);
+    std::vector<int> fillPos(elementOffsets.begin(), elementOffsets.end() - 1);
+    for (int i = 0; i < m; ++i) {
+        for (int element : sets[i]) {
+            if (element >= 0 && element < n) {
+                elementSets[fillPos[element]++] = i;
+            }
+        }
+    }
+
+    int maxGain = m > 0 ? *std::max_element(gain.begin(), gain.end()) : 0;
+    std::vector<std::vector<int>> buckets(maxGain + 1);
+    // Обратный порядок, чтобы среди равных начальных выигрышей первым извлекался меньший индекс
+    for (int i = m - 1; i >= 0; --i) {
+        if (gain[i] > 0) {
+            buckets[gain[i]].push_back(i);
+        }
+    }
+
+    std::vector<char> covered(n, 0);
+    std::vector<char> chosen(m, 0);
+    int coveredCount = 0;
+    int top = maxGain;
+
+    while (coveredCount < n) {
+        int bestSet = -1;
+        while (top > 0 && bestSet == -1) {
+            if (buckets[top].empty()) {
+                --top;
+                continue;
+            }
+            int i = buckets[top].back();
+            buckets[top].pop_back();
+            if (!chosen[i] && gain[i] == top) {
+                bestSet = i;
+            }
+        }
+
+        if (bestSet == -1) {
+            return false;
+        }
+
+        cover.push_back(bestSet);
+        chosen[bestSet] = 1;
+        for (int element : sets[bestSet]) {
+            if (element < 0 || element >= n || covered[element]) continue;
+            covered[element] = 1;
+            coveredCount++;
+            for (int k = elementOffsets[element]; k < elementOffsets[element + 1]; ++k) {
+                int j = elementSets[k];
+                if (chosen[j]) continue;
+                if (--gain[j] > 0) {
+                    buckets[gain[j]].push_back(j);
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+// Жадный алгоритм в битовом режиме: covered — массив 64-битных слов. Плотные множества
+// (не короче своей битовой карты в словах) хранятся битовыми картами, и их выигрыш считается
+// как popcount(set & ~covered); для разреженных проверяется бит каждого элемента.
+// Выбор и порядок совпадают с greedySetCover.
+inline bool bitsetGreedySetCover(const SetSystem &sets, int n, std::vector<int> &cover, bool useBitmaps = true) {
+    int m = sets.size();
+    int words = bitsetWords(n);
+    std::vector<uint64_t> covered(words, 0);
+    int coveredCount = 0;
+
+    // Индекс битовой карты множества или -1, если множество хранится списком
+    std::vector<int> bitmapIndex(m, -1);
+    std::vector<uint64_t> bitmaps;
+    if (useBitmaps) {
+        int bitmapCount = 0;
+        for (int i = 0; i < m; ++i) {
+            if (sets[i].size() >= words) {
+                bitmapIndex[i] = bitmapCount++;
+            }
+        }
+        bitmaps.assign((std::size_t) bitmapCount * words, 0);
+        for (int i = 0; i < m; ++i) {
+            if (bitmapIndex[i] == -1) continue;
+            uint64_t *bitmap = bitmaps.data() + (std::size_t) bitmapIndex[i] * words;
+            for (int element : sets[i]) {
+                if (element >= 0 && element < n) {
+                    bitmap[element >> 6] |= uint64_t(1) << (element & 63);
+                }
+            }
+        }
+    }
+
+    while (coveredCount < n) {
+        int bestSet = -1;
+        int maxCover = 0;
+        for (int i = 0; i < m; ++i) {
+            int currentCover = 0;
+            if (bitmapIndex[i] != -1) {
+                currentCover = andNotPopcount(bitmaps.data() + (std::size_t) bitmapIndex[i] * words, covered.data(), words);
+            } else {
+                for (int element : sets[i]) {
+                    if (element >= 0 && element < n && !testBit(covered.data(), element)) {
+                        currentCover++;
+                    }
+                }
+            }
+            if (currentCover > maxCover) {
+                maxCover = currentCover;
+                bestSet = i;
+            }
+        }
+
+        if (bestSet == -1) {
+            return false;
+        }
+
+        cover.push_back(bestSet);
+        for (int element : sets[bestSet]) {
+            if (element >= 0 && element < n && !testBit(covered.data(), element)) {
+                setBit(covered, element);
+                coveredCount++;
+            }
+        }
+    }
+
+    return true;
+}
+
+// Параллельный жадный алгоритм: множества делятся на блоки между потоками пула, каждый блок
+// находит свою лучшую пару (выигрыш, индекс), а блоки сводятся по порядку с тем же правилом
+// «меньший индекс при равенстве», поэтому покрытие совпадает с greedySetCover.
+inline bool parallelGreedySetCover(const SetSystem &sets, int n, std::vector<int> &cover, ThreadPool &pool) {
+    int m = sets.size();
+    std::vector<uint64_t> covered(bitsetWords(n), 0);
+    int coveredCount = 0;
+
+    int chunks = std::min(m, pool.size() * 4);
+    std::vector<int> chunkBestSet(chunks);
+    std::vector<int> chunkMaxCover(chunks);
+
+    auto scanChunk = [&](int chunk) {
+        int begin = (long long) m * chunk / chunks;
+        int end = (long long) m * (chunk + 1) / chunks;
+        int bestSet = -1;
+        int maxCover = 0;
+        for (int i = begin; i < end; ++i) {
+            int currentCover = 0;
+            for (int element : sets[i]) {
+                if (element >= 0 && element < n && !testBit(covered.data(), element)) {
+                    currentCover++;
+                }
+            }
+            if (currentCover > maxCover) {
+                maxCover = currentCover;
+                bestSet = i;
+            }
+        }
+        chunkBestSet[chunk] = bestSet;
+        chunkMaxCover[chunk] = maxCover;
+    };
+
+    while (coveredCount < n) {
+        pool.parallelFor(chunks, scanChunk);
+
+        int bestSet = -1;
+        int maxCover = 0;
+        for (int chunk = 0; chunk < chunks; ++chunk) {
+            if (chunkMaxCover[chunk] > maxCover) {
+                maxCover = chunkMaxCover[chunk];
+                bestSet = chunkBestSet[chunk];
+            }
+        }
+
+        if (bestSet == -1) {
+            return false;
+        }
+
+        cover.push_back(bestSet);
+        for (int element : sets[bestSet]) {
+            if (element >= 0 && element < n && !testBit(covered.data(), element)) {
+                setBit(covered, element);
+                coveredCount++;
+            }
+        }
+    }
+
+    return true;
+}
+
+// Взвешенный жадный алгоритм: выбирается множество с наименьшей стоимостью на новый покрытый элемент.
+// Выигрыш только убывает, а отношение стоимость/выигрыш только растёт, поэтому, как в lazyGreedySetCover,
+// пересчитывается лишь вершина кучи. При равном отношении выбирается меньший индекс.
+inline bool weightedGreedySetCover(const SetSystem &sets, int n, std::vector<int> &cover) {
+    int m = sets.size();
+    std::vector<uint64_t> covered(bitsetWords(n), 0);
+    int coveredCount = 0;
+
+    // Кортеж (стоимость на элемент, индекс, выигрыш на момент вставки); вершина — наименьшее отношение
+    using Entry = std::tuple<double, int, int>;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> heap;
+    for (int i = 0; i < m; ++i) {
+        int gain = 0;
+        for (int element : sets[i]) {
+            if (element >= 0 && element < n) {
+                gain++;
+            }
+        }
+        if (gain > 0) {
+            heap.emplace(sets.cost(i) / gain, i, gain);
+        }
+    }
+
+    while (coveredCount < n) {
+        int bestSet = -1;
+        while (!heap.empty()) {
+            auto [staleRatio, i, staleGain] = heap.top();
+            heap.pop();
+
+            int currentCover = 0;
+            for (int element : sets[i]) {
+                if (element >= 0 && element < n && !testBit(covered.data(), element)) {
+                    currentCover++;
+                }
+            }
+
+            if (currentCover == staleGain) {
+                bestSet = i;
+                break;
+            }
+            if (currentCover > 0) {
+                heap.emplace(sets.cost(i) / currentCover, i, currentCover);
+            }
+        }
+
+        if (bestSet == -1) {
+            return false;
+        }
+
+        cover.push_back(bestSet);
+        for (int element : sets[bestSet]) {
+            if (element >= 0 && element < n && !testBit(covered.data(), element)) {
+                setBit(covered, element);
+                coveredCount++;
+            }
+        }
+    }
+
+    return true;
+}
+
+// Статистика одного прохода потокового алгоритма
+struct StreamingPassStats {
+    double threshold;
+    int picked;
+    long long setsRead;
+    long long elementsRead;
+    long long bytesRead;
+    double seconds;
+};
+
+// Потоковый жадный алгоритм: множества читаются из файла последовательно (формат как у ввода:
+// "n m", затем элементы каждого множества, завершённые -1), в памяти только битовая карта покрытия
+// и номера выбранных множеств. Каждый проход берёт множества с выигрышем не меньше порога,
+// порог уменьшается в factor раз (как у Saha–Getoor), но не выше наибольшего отвергнутого выигрыша,
+// чтобы не тратить пустые проходы. Проходов O(log n), память O(n).
+inline bool streamingSetCover(const std::string &path, std::vector<int> &cover, double factor,
+                              std::vector<StreamingPassStats> &stats) {
+    std::ifstream input(path);
+    if (!input) {
+        std::cout << "Cannot open " << path << std::endl;
+        return false;
+    }
+    int n, m;
+    if (!(input >> n >> m)) {
+        std::cout << "Invalid header in " << path << std::endl;
+        return false;
+    }
+    std::streampos dataStart = input.tellg();
+    input.seekg(0, std::ios::end);
+    long long dataBytes = input.tellg() - dataStart;
+
+    std::vector<uint64_t> covered(bitsetWords(n), 0);
+    std::vector<uint64_t> seen(bitsetWords(n), 0); // Элементы текущего множества, уже учтённые в выигрыше
+    std::vector<int> fresh;                        // Непокрытые элементы текущего множества
+    int coveredCount = 0;
+    double threshold = n;
+
+    while (coveredCount < n) {
+        auto start = std::chrono::high_resolution_clock::now();
+        StreamingPassStats pass{threshold, 0, 0, 0, 0, 0};
+        int maxRejectedGain = 0;
+
+        input.clear();
+        input.seekg(dataStart);
+        for (int i = 0; i < m; ++i) {
+            fresh.clear();
+            int element;
+            while (input >> element && element != -1) {
+                pass.elementsRead++;
+                if (element < 0 || element >= n) continue;
+                if (testBit(covered.data(), element) || testBit(seen.data(), element)) continue;
+                setBit(seen, element);
+                fresh.push_back(element);
+            }
+            pass.setsRead++;
+
+            int gain = fresh.size();
+            if (gain > 0 && gain >= threshold) {
+                cover.push_back(i);
+                pass.picked++;
+                for (int e : fresh) {
+                    setBit(covered, e);
+                }
+                coveredCount += gain;
+            } else {
+                maxRejectedGain = std::max(maxRejectedGain, gain);
+            }
+            for (int e : fresh) {
+                seen[e >> 6] &= ~(uint64_t(1) << (e & 63));
+            }
+        }
+
+        pass.bytesRead = dataBytes;
+        pass.seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+        stats.push_back(pass);
+
+        if (coveredCount < n && maxRejectedGain == 0 && pass.picked == 0) {
+            return false;
+        }
+        threshold = std::max(1.0, std::min(threshold / factor, (double) maxRejectedGain));
+    }
+
+    return true;
+}
+
+#endif // SET_COVER_H
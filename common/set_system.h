@@ -0,0 +1,130 @@
+#ifndef SET_SYSTEM_H
+#define SET_SYSTEM_H
+
+#include <vector>
+#include <set>
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+
+// Непрерывное представление семейства множеств (CSR): множество i занимает
+// элементы [offsets[i], offsets[i + 1]) массива elements, элементы отсортированы и без повторов.
+// Стоимости множеств необязательны: пустой costs означает единичную стоимость.
+// Массивы могут лежать и в отображённом в память файле (см. binary_format.h), тогда векторы пусты.
+struct SetSystem {
+    // Лёгкое представление одного множества для range-for
+    struct SetView {
+        const int *first;
+        const int *last;
+
+        const int *begin() const { return first; }
+        const int *end() const { return last; }
+        int size() const { return last - first; }
+        bool empty() const { return first == last; }
+    };
+
+    std::vector<int> offsets{0};
+    std::vector<int> elements;
+    std::vector<double> costs;
+
+    // Внешние массивы (отображённый файл); mapping держит отображение, пока жива система
+    const int *mappedOffsets = nullptr;
+    const int *mappedElements = nullptr;
+    const double *mappedCosts = nullptr;
+    int mappedCount = 0;
+    std::shared_ptr<const void> mapping;
+
+    int size() const {
+        return mappedOffsets ? mappedCount : offsets.size() - 1;
+    }
+
+    std::size_t totalSize() const {
+        return mappedOffsets ? mappedOffsets[mappedCount] : elements.size();
+    }
+
+    SetView operator[](int i) const {
+        const int *offsetData = mappedOffsets ? mappedOffsets : offsets.data();
+        const int *base = mappedOffsets ? mappedElements : elements.data();
+        return {base + offsetData[i], base + offsetData[i + 1]};
+    }
+
+    // Добавление множества; элементы сортируются и очищаются от повторов на месте
+    void addSet(std::vector<int> &setElements) {
+        std::sort(setElements.begin(), setElements.end());
+        setElements.erase(std::unique(setElements.begin(), setElements.end()), setElements.end());
+        elements.insert(elements.end(), setElements.begin(), setElements.end());
+        offsets.push_back(elements.size());
+    }
+
+    // Добавление множества из диапазона; сортировка и удаление повторов — уже в elements
+    void addSet(const int *first, const int *last) {
+        elements.insert(elements.end(), first, last);
+        finishSet();
+    }
+
+    // Завершение множества, элементы которого уже дописаны в конец elements
+    void finishSet() {
+        auto start = elements.begin() + offsets.back();
+        std::sort(start, elements.end());
+        elements.erase(std::unique(start, elements.end()), elements.end());
+        offsets.push_back(elements.size());
+    }
+
+    bool weighted() const {
+        return mappedCosts || !costs.empty();
+    }
+
+    double cost(int i) const {
+        if (mappedCosts) return mappedCosts[i];
+        return costs.empty() ? 1.0 : costs[i];
+    }
+
+    // Суммарная стоимость выбранных множеств
+    double totalCost(const std::vector<int> &cover) const {
+        double total = 0;
+        for (int i : cover) {
+            total += cost(i);
+        }
+        return total;
+    }
+
+    void reserve(int setCount, std::size_t elementCount) {
+        offsets.reserve(setCount + 1);
+        elements.reserve(elementCount);
+    }
+
+    // Занимаемая память в байтах (для отображённого файла — размер массивов в файле)
+    std::size_t memoryBytes() const {
+        if (mappedOffsets) {
+            return sizeof(SetSystem) + (size() + 1) * sizeof(int) + totalSize() * sizeof(int) +
+                   (mappedCosts ? size() * sizeof(double) : 0);
+        }
+        return sizeof(SetSystem) + offsets.capacity() * sizeof(int) + elements.capacity() * sizeof(int) +
+               costs.capacity() * sizeof(double);
+    }
+
+    static SetSystem fromSets(const std::vector<std::set<int>> &sets) {
+        SetSystem system;
+        std::size_t total = 0;
+        for (const auto &s : sets) {
+            total += s.size();
+        }
+        system.reserve(sets.size(), total);
+        for (const auto &s : sets) {
+            // std::set уже отсортирован и без повторов
+            system.elements.insert(system.elements.end(), s.begin(), s.end());
+            system.offsets.push_back(system.elements.size());
+        }
+        return system;
+    }
+};
+
+// Оценка памяти того же семейства в виде std::vector<std::set<int>>:
+// узел красно-чёрного дерева — цвет, три указателя и значение, каждое поле выровнено по указателю
+// (накладные расходы malloc не учитываются)
+inline std::size_t treeMemoryEstimate(const SetSystem &system) {
+    std::size_t nodeBytes = 5 * sizeof(void *);
+    return sizeof(std::vector<std::set<int>>) + system.size() * sizeof(std::set<int>) + system.totalSize() * nodeBytes;
+}
+
+#endif // SET_SYSTEM_H
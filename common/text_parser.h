@@ -0,0 +1,93 @@
+#ifndef TEXT_PARSER_H
+#define TEXT_PARSER_H
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+
+#include "mapped_file.h"
+#include "thread_pool.h"
+
+// Быстрый разбор текстовых экземпляров: файл отображается в память, делится на блоки
+// по границам строк, и блоки разбираются параллельно через std::from_chars.
+// Результат — все целые числа файла по порядку; формат (заголовок, -1 в конце множества и т.п.)
+// интерпретирует сама программа.
+
+inline bool isSpace(char c) {
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+// Разбор целых чисел из [first, last); при ошибке возвращает позицию некорректного символа
+inline const char *parseIntegers(const char *first, const char *last, std::vector<int> &values) {
+    const char *p = first;
+    while (true) {
+        while (p < last && isSpace(*p)) ++p;
+        if (p == last) return nullptr;
+        int value;
+        auto [next, ec] = std::from_chars(p, last, value);
+        if (ec != std::errc() || (next < last && !isSpace(*next))) {
+            return p;
+        }
+        values.push_back(value);
+        p = next;
+    }
+}
+
+// Деление текста на блоки не меньше 1 МБ (не больше pool.size() * 4) для параллельного разбора.
+// Границы сдвигаются к ближайшему концу строки, чтобы число или строка не разрезались.
+inline std::vector<std::size_t> lineAlignedChunks(const char *data, std::size_t size, ThreadPool &pool) {
+    const std::size_t minChunk = 1 << 20;
+    int chunks = std::max<std::size_t>(1, std::min<std::size_t>(pool.size() * 4, size / minChunk));
+    std::vector<std::size_t> bounds(chunks + 1, size);
+    bounds[0] = 0;
+    for (int c = 1; c < chunks; ++c) {
+        std::size_t position = std::max(bounds[c - 1], size / chunks * c);
+        const void *newline = position < size ? std::memchr(data + position, '\n', size - position) : nullptr;
+        bounds[c] = newline ? static_cast<const char *>(newline) - data + 1 : size;
+    }
+    return bounds;
+}
+
+inline bool parseIntegerFile(const std::string &path, std::vector<int> &values, ThreadPool &pool) {
+    MappedFile file;
+    if (!file.open(path)) {
+        std::cout << "Cannot open " << path << std::endl;
+        return false;
+    }
+    const char *data = file.data();
+    std::size_t size = file.size();
+
+    std::vector<std::size_t> bounds = lineAlignedChunks(data, size, pool);
+    int chunks = bounds.size() - 1;
+
+    std::vector<std::vector<int>> chunkValues(chunks);
+    std::vector<const char *> errors(chunks, nullptr);
+    pool.parallelFor(chunks, [&](int c) {
+        // Оценка: не меньше одного числа на 8 байт текста
+        chunkValues[c].reserve((bounds[c + 1] - bounds[c]) / 8);
+        errors[c] = parseIntegers(data + bounds[c], data + bounds[c + 1], chunkValues[c]);
+    });
+
+    for (int c = 0; c < chunks; ++c) {
+        if (errors[c]) {
+            std::cout << path << ": unexpected character at byte " << errors[c] - data << std::endl;
+            return false;
+        }
+    }
+
+    std::size_t total = values.size();
+    for (const auto &chunk : chunkValues) {
+        total += chunk.size();
+    }
+    values.reserve(total);
+    for (auto &chunk : chunkValues) {
+        values.insert(values.end(), chunk.begin(), chunk.end());
+        std::vector<int>().swap(chunk);
+    }
+    return true;
+}
+
+#endif // TEXT_PARSER_H
@@ -0,0 +1,116 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <atomic>
+#include <algorithm>
+#include <cstdint>
+
+// Пул потоков фиксированного размера для параллельных циклов.
+// parallelFor(count, task) вызывает task(i) для i из [0, count) и возвращается, когда все задачи выполнены.
+// Индексы раздаются динамически через атомарный счётчик; вызывающий поток тоже выполняет задачи.
+class ThreadPool {
+public:
+    explicit ThreadPool(int threadCount = 0) {
+        if (threadCount <= 0) {
+            threadCount = std::max(1u, std::thread::hardware_concurrency());
+        }
+        for (int i = 1; i < threadCount; ++i) {
+            workers.emplace_back([this] { workerLoop(); });
+        }
+    }
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wakeCv.notify_all();
+        for (auto &worker : workers) {
+            worker.join();
+        }
+    }
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    int size() const {
+        return workers.size() + 1;
+    }
+
+    void parallelFor(int count, const std::function<void(int)> &task) {
+        if (count <= 0) return;
+        if (workers.empty() || count == 1) {
+            for (int i = 0; i < count; ++i) {
+                task(i);
+            }
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            job = &task;
+            jobCount = count;
+            next.store(0);
+            joined = 0;
+            ++generation;
+        }
+        wakeCv.notify_all();
+
+        runTasks(task, count);
+
+        // Каждый рабочий поток обязан отметиться в поколении, поэтому «опоздавших» с чужой задачей не бывает
+        std::unique_lock<std::mutex> lock(mutex);
+        doneCv.wait(lock, [&] { return joined == (int) workers.size() && active == 0; });
+        job = nullptr;
+    }
+
+private:
+    void runTasks(const std::function<void(int)> &task, int count) {
+        while (true) {
+            int i = next.fetch_add(1);
+            if (i >= count) break;
+            task(i);
+        }
+    }
+
+    void workerLoop() {
+        std::unique_lock<std::mutex> lock(mutex);
+        uint64_t seen = 0;
+        while (true) {
+            wakeCv.wait(lock, [&] { return stopping || generation != seen; });
+            if (stopping) return;
+            seen = generation;
+            const std::function<void(int)> *task = job;
+            int count = jobCount;
+            ++joined;
+            ++active;
+            lock.unlock();
+
+            runTasks(*task, count);
+
+            lock.lock();
+            if (--active == 0 && joined == (int) workers.size()) {
+                doneCv.notify_all();
+            }
+        }
+    }
+
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable wakeCv;
+    std::condition_variable doneCv;
+    const std::function<void(int)> *job = nullptr;
+    int jobCount = 0;
+    std::atomic<int> next{0};
+    uint64_t generation = 0;
+    int joined = 0;
+    int active = 0;
+    bool stopping = false;
+};
+
+#endif // THREAD_POOL_H
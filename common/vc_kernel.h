@@ -0,0 +1,442 @@
+#ifndef VC_KERNEL_H
+#define VC_KERNEL_H
+
+#include <vector>
+#include <array>
+#include <algorithm>
+#include <chrono>
+#include <climits>
+
+#include "csr_graph.h"
+#include "thread_pool.h"
+
+// Сведение задачи о вершинном покрытии к ядру перед запуском алгоритма.
+// Правила: изолированные вершины удаляются; сосед вершины степени 1 берётся в покрытие;
+// вершина степени 2 с несмежными соседями a, b сворачивается вместе с ними в новую вершину;
+// если N[v] ⊆ N[u] для соседей u, v, берётся u (доминирование, в том числе треугольники);
+// вершины со значением 1 в полуцелом решении LP (Немхаузер–Троттер, обобщение коронного правила)
+// берутся в покрытие. LP находится через максимальное паросочетание в двудольном удвоении графа.
+// Для графа с разными весами применяются только правила, корректные для весов: удаление изолированных,
+// степень 1 и доминирование при w(u) <= w(v).
+// Решение ядра поднимается обратно в исходный граф через lift.
+
+struct VertexCoverKernel {
+    CsrGraph graph;                          // ядро с компактной нумерацией вершин
+    std::vector<int> kernelToVertex;         // вершина ядра -> рабочая вершина
+    std::vector<int> forced;                 // рабочие вершины, взятые в покрытие правилами
+    std::vector<std::array<int, 4>> folds;   // свёртки {v, a, b, w}: v, a, b заменены вершиной w
+    int originalVertices = 0;
+    int workingVertices = 0;                 // исходные вершины и вершины, созданные свёртками
+    long long reductionTime = 0;             // время сведения, мкс
+
+    // Покрытие исходного графа по покрытию ядра. Свёртки разворачиваются в обратном порядке:
+    // если w в покрытии, вместо неё берутся a и b, иначе берётся v.
+    template <typename Cover>
+    std::vector<int> lift(const Cover &kernelCover) const {
+        std::vector<char> inCover(workingVertices, 0);
+        for (int v : kernelCover) {
+            inCover[kernelToVertex[v]] = 1;
+        }
+        for (int v : forced) {
+            inCover[v] = 1;
+        }
+        for (auto it = folds.rbegin(); it != folds.rend(); ++it) {
+            auto [v, a, b, w] = *it;
+            if (inCover[w]) {
+                inCover[w] = 0;
+                inCover[a] = 1;
+                inCover[b] = 1;
+            } else {
+                inCover[v] = 1;
+            }
+        }
+        std::vector<int> cover;
+        for (int v = 0; v < originalVertices; ++v) {
+            if (inCover[v]) {
+                cover.push_back(v);
+            }
+        }
+        return cover;
+    }
+};
+
+// Рабочий граф сведения: списки соседей могут содержать удалённые вершины,
+// deg хранит число живых соседей.
+class VertexCoverReducer {
+public:
+    VertexCoverReducer(const CsrGraph &graph, VertexCoverKernel &kernel) : kernel(kernel) {
+        int V = graph.V;
+        adj.resize(V);
+        deg.assign(V, 0);
+        alive.assign(V, 1);
+        inQueue.assign(V, 0);
+        mark.assign(V, 0);
+        weights.resize(V);
+        uniform = true;
+        for (int v = 0; v < V; ++v) {
+            weights[v] = graph.weight(v);
+            uniform = uniform && weights[v] == weights[0];
+        }
+
+        // Повторные рёбра не нужны, петля заставляет взять вершину
+        std::vector<int> selfLoops;
+        for (int v = 0; v < V; ++v) {
+            auto neighbors = graph.neighborsOf(v);
+            adj[v].assign(neighbors.begin(), neighbors.end());
+            std::sort(adj[v].begin(), adj[v].end());
+            adj[v].erase(std::unique(adj[v].begin(), adj[v].end()), adj[v].end());
+            auto self = std::lower_bound(adj[v].begin(), adj[v].end(), v);
+            if (self != adj[v].end() && *self == v) {
+                adj[v].erase(self);
+                selfLoops.push_back(v);
+            }
+            deg[v] = adj[v].size();
+        }
+        for (int v : selfLoops) {
+            if (alive[v]) {
+                removeVertex(v, true);
+            }
+        }
+        for (int v = 0; v < V; ++v) {
+            enqueue(v);
+        }
+    }
+
+    void reduce() {
+        bool changed = true;
+        while (changed) {
+            processQueue();
+            changed = applyDomination();
+            if (!changed && uniform) {
+                changed = applyLinearProgram();
+            }
+        }
+    }
+
+    int vertexCount() const {
+        return adj.size();
+    }
+
+    bool isAlive(int v) const {
+        return alive[v];
+    }
+
+    int weight(int v) const {
+        return weights[v];
+    }
+
+    template <typename Visitor>
+    void forEachNeighbor(int v, Visitor visit) const {
+        for (int u : adj[v]) {
+            if (alive[u]) visit(u);
+        }
+    }
+
+private:
+    VertexCoverKernel &kernel;
+    std::vector<std::vector<int>> adj;
+    std::vector<int> deg;
+    std::vector<char> alive;
+    std::vector<char> inQueue;
+    std::vector<int> mark;
+    std::vector<int> weights;
+    std::vector<int> queue;
+    int stamp = 0;
+    bool uniform;
+
+    void enqueue(int v) {
+        if (!inQueue[v]) {
+            inQueue[v] = 1;
+            queue.push_back(v);
+        }
+    }
+
+    void removeVertex(int v, bool take) {
+        alive[v] = 0;
+        if (take) {
+            kernel.forced.push_back(v);
+        }
+        for (int u : adj[v]) {
+            if (alive[u]) {
+                deg[u]--;
+                enqueue(u);
+            }
+        }
+        std::vector<int>().swap(adj[v]);
+    }
+
+    int nextStamp() {
+        if (++stamp == INT_MAX) {
+            std::fill(mark.begin(), mark.end(), 0);
+            stamp = 1;
+        }
+        return stamp;
+    }
+
+    bool adjacent(int a, int b) const {
+        const std::vector<int> &shorter = adj[a].size() <= adj[b].size() ? adj[a] : adj[b];
+        int other = adj[a].size() <= adj[b].size() ? b : a;
+        return std::find(shorter.begin(), shorter.end(), other) != shorter.end();
+    }
+
+    // Степени 0, 1 и 2, пока очередь не опустеет
+    void processQueue() {
+        while (!queue.empty()) {
+            int v = queue.back();
+            queue.pop_back();
+            inQueue[v] = 0;
+            if (!alive[v]) continue;
+
+            if (deg[v] == 0) {
+                removeVertex(v, false);
+            } else if (deg[v] == 1) {
+                int u = -1;
+                forEachNeighbor(v, [&](int x) { u = x; });
+                if (weights[u] <= weights[v]) {
+                    removeVertex(u, true);
+                }
+            } else if (deg[v] == 2 && uniform) {
+                int a = -1;
+                int b = -1;
+                forEachNeighbor(v, [&](int x) { (a == -1 ? a : b) = x; });
+                if (adjacent(a, b)) {
+                    removeVertex(a, true);
+                    removeVertex(b, true);
+                } else {
+                    fold(v, a, b);
+                }
+            }
+        }
+    }
+
+    // v, a, b заменяются новой вершиной w со соседями N(a) ∪ N(b) \ {v}
+    void fold(int v, int a, int b) {
+        int w = adj.size();
+        adj.emplace_back();
+        deg.push_back(0);
+        alive.push_back(1);
+        inQueue.push_back(0);
+        mark.push_back(0);
+        weights.push_back(weights[v]);
+
+        alive[v] = 0;
+        alive[a] = 0;
+        alive[b] = 0;
+
+        // mark = stamp: сосед одной из a, b; stamp + 1: сосед обеих
+        int first = nextStamp();
+        int both = nextStamp();
+        for (int x : {a, b}) {
+            for (int u : adj[x]) {
+                if (!alive[u]) continue;
+                if (mark[u] == first) {
+                    mark[u] = both;
+                } else if (mark[u] != both) {
+                    mark[u] = first;
+                    adj[w].push_back(u);
+                }
+            }
+        }
+        for (int u : adj[w]) {
+            deg[u] -= mark[u] == both ? 1 : 0;
+            adj[u].push_back(w);
+            enqueue(u);
+        }
+        deg[w] = adj[w].size();
+
+        std::vector<int>().swap(adj[v]);
+        std::vector<int>().swap(adj[a]);
+        std::vector<int>().swap(adj[b]);
+        kernel.folds.push_back({v, a, b, w});
+        enqueue(w);
+    }
+
+    // Доминирование: u берётся, если для соседа v выполнено N[v] ⊆ N[u] (и w(u) <= w(v))
+    bool applyDomination() {
+        bool changed = false;
+        for (int u = 0; u < vertexCount(); ++u) {
+            if (!alive[u] || deg[u] == 0) continue;
+            int current = nextStamp();
+            mark[u] = current;
+            forEachNeighbor(u, [&](int x) { mark[x] = current; });
+
+            bool dominates = false;
+            for (int v : adj[u]) {
+                if (!alive[v] || deg[v] > deg[u] || weights[u] > weights[v]) continue;
+                dominates = true;
+                for (int y : adj[v]) {
+                    if (alive[y] && mark[y] != current) {
+                        dominates = false;
+                        break;
+                    }
+                }
+                if (dominates) break;
+            }
+            if (dominates) {
+                removeVertex(u, true);
+                changed = true;
+            }
+        }
+        processQueue();
+        return changed;
+    }
+
+    // LP-правило: максимальное паросочетание (Хопкрофт–Карп) в двудольном графе L x R с рёбрами
+    // (uL, vR) и (vL, uR), минимальное покрытие по Кёнигу; вершины, вошедшие обеими копиями, берутся
+    bool applyLinearProgram() {
+        std::vector<int> index(vertexCount(), -1);
+        std::vector<int> vertices;
+        for (int v = 0; v < vertexCount(); ++v) {
+            if (alive[v]) {
+                index[v] = vertices.size();
+                vertices.push_back(v);
+            }
+        }
+        int n = vertices.size();
+        if (n == 0) return false;
+
+        std::vector<int> offsets(n + 1, 0);
+        std::vector<int> targets;
+        for (int i = 0; i < n; ++i) {
+            forEachNeighbor(vertices[i], [&](int x) { targets.push_back(index[x]); });
+            offsets[i + 1] = targets.size();
+        }
+
+        const int infinity = INT_MAX;
+        std::vector<int> matchLeft(n, -1);
+        std::vector<int> matchRight(n, -1);
+        std::vector<int> dist(n);
+        std::vector<int> position(n);
+        std::vector<int> bfsQueue;
+        std::vector<int> stack;
+        std::vector<int> via;
+
+        while (true) {
+            // Слои от свободных вершин слева
+            bfsQueue.clear();
+            for (int i = 0; i < n; ++i) {
+                dist[i] = matchLeft[i] == -1 ? 0 : infinity;
+                if (matchLeft[i] == -1) bfsQueue.push_back(i);
+            }
+            bool found = false;
+            for (std::size_t head = 0; head < bfsQueue.size(); ++head) {
+                int i = bfsQueue[head];
+                for (int k = offsets[i]; k < offsets[i + 1]; ++k) {
+                    int j = matchRight[targets[k]];
+                    if (j == -1) {
+                        found = true;
+                    } else if (dist[j] == infinity) {
+                        dist[j] = dist[i] + 1;
+                        bfsQueue.push_back(j);
+                    }
+                }
+            }
+            if (!found) break;
+
+            // Увеличивающие пути по слоям, итеративный обход в глубину
+            for (int i = 0; i < n; ++i) {
+                position[i] = offsets[i];
+            }
+            for (int root = 0; root < n; ++root) {
+                if (matchLeft[root] != -1) continue;
+                stack.assign(1, root);
+                via.clear();
+                while (!stack.empty()) {
+                    int i = stack.back();
+                    if (position[i] == offsets[i + 1]) {
+                        dist[i] = infinity;
+                        stack.pop_back();
+                        if (!via.empty()) via.pop_back();
+                        continue;
+                    }
+                    int r = targets[position[i]++];
+                    int j = matchRight[r];
+                    if (j == -1) {
+                        via.push_back(r);
+                        for (std::size_t level = 0; level < stack.size(); ++level) {
+                            matchLeft[stack[level]] = via[level];
+                            matchRight[via[level]] = stack[level];
+                        }
+                        break;
+                    }
+                    if (dist[j] == dist[i] + 1) {
+                        via.push_back(r);
+                        stack.push_back(j);
+                    }
+                }
+            }
+        }
+
+        // Достижимость по чередующимся путям от свободных вершин слева
+        std::vector<char> reachedLeft(n, 0);
+        std::vector<char> reachedRight(n, 0);
+        bfsQueue.clear();
+        for (int i = 0; i < n; ++i) {
+            if (matchLeft[i] == -1) {
+                reachedLeft[i] = 1;
+                bfsQueue.push_back(i);
+            }
+        }
+        for (std::size_t head = 0; head < bfsQueue.size(); ++head) {
+            int i = bfsQueue[head];
+            for (int k = offsets[i]; k < offsets[i + 1]; ++k) {
+                int r = targets[k];
+                if (reachedRight[r]) continue;
+                reachedRight[r] = 1;
+                int j = matchRight[r];
+                if (j != -1 && !reachedLeft[j]) {
+                    reachedLeft[j] = 1;
+                    bfsQueue.push_back(j);
+                }
+            }
+        }
+
+        // Покрытие по Кёнигу: L без достижимых и достижимые из R; x_v = 1, если вошли обе копии
+        bool changed = false;
+        for (int i = 0; i < n; ++i) {
+            if (!reachedLeft[i] && reachedRight[i] && alive[vertices[i]]) {
+                removeVertex(vertices[i], true);
+                changed = true;
+            }
+        }
+        return changed;
+    }
+};
+
+// Сведение графа к ядру; ядро строится в CSR на пуле потоков
+inline VertexCoverKernel reduceVertexCover(const CsrGraph &graph, ThreadPool &pool) {
+    auto start = std::chrono::steady_clock::now();
+
+    VertexCoverKernel kernel;
+    kernel.originalVertices = graph.V;
+    VertexCoverReducer reducer(graph, kernel);
+    reducer.reduce();
+    kernel.workingVertices = reducer.vertexCount();
+
+    std::vector<int> index(reducer.vertexCount(), -1);
+    for (int v = 0; v < reducer.vertexCount(); ++v) {
+        if (reducer.isAlive(v)) {
+            index[v] = kernel.kernelToVertex.size();
+            kernel.kernelToVertex.push_back(v);
+        }
+    }
+
+    EdgeList edgeList(kernel.kernelToVertex.size());
+    for (int i = 0; i < edgeList.V; ++i) {
+        int v = kernel.kernelToVertex[i];
+        if (graph.weighted()) {
+            edgeList.setWeight(i, reducer.weight(v));
+        }
+        reducer.forEachNeighbor(v, [&](int u) {
+            if (index[u] > i) {
+                edgeList.addEdge(i, index[u]);
+            }
+        });
+    }
+    kernel.graph = buildCsrGraph(edgeList, pool);
+
+    kernel.reductionTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    return kernel;
+}
+
+#endif // VC_KERNEL_H
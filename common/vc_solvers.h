@@ -0,0 +1,809 @@
+#ifndef VC_SOLVERS_H
+#define VC_SOLVERS_H
+
+#include <vector>
+#include <unordered_set>
+#include <algorithm>
+#include <chrono>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <deque>
+#include <mutex>
+#include <memory>
+#include <thread>
+
+#include "bitset_ops.h"
+#include "csr_graph.h"
+#include "graph_components.h"
+#include "thread_pool.h"
+
+// Алгоритмы вершинного покрытия на CsrGraph: исходный жадный, жадный на корзинах степеней,
+// параллельное паросочетание, локальный поиск, точный метод ветвей и границ и решение по компонентам.
+// Общие для greedy_cover и greedy_cover_test.
+
+inline std::unordered_set<int> greedyVertexCover(const CsrGraph& graph) {
+    std::unordered_set<int> cover;
+    std::vector<bool> coveredEdges(graph.E, false);
+    std::vector<std::pair<int, int>> edges;
+
+    // Создаем список ребер
+    for (int u = 0; u < graph.V; ++u) {
+        for (int v : graph.neighborsOf(u)) {
+            if (u < v) {
+                edges.emplace_back(u, v);
+            }
+        }
+    }
+
+    while (std::count(coveredEdges.begin(), coveredEdges.end(), false) > 0) {
+        int maxDegreeVertex = -1;
+        int maxDegree = -1;
+
+        // Находим вершину с наибольшей степенью (количеством непокрытых соседей)
+        for (int i = 0; i < graph.V; ++i) {
+            if (cover.count(i)) continue;
+            int degree = 0;
+            for (int neighbor : graph.neighborsOf(i)) {
+                if (!cover.count(neighbor)) {
+                    degree++;
+                }
+            }
+
+            if (degree > maxDegree) {
+                maxDegree = degree;
+                maxDegreeVertex = i;
+            }
+        }
+
+        // Добавляем вершину с наибольшей степенью в покрытие
+        cover.insert(maxDegreeVertex);
+
+        // Отмечаем все инцидентные ребра как покрытые
+        for (int i = 0; i < edges.size(); ++i) {
+            if (!coveredEdges[i] && (edges[i].first == maxDegreeVertex || edges[i].second == maxDegreeVertex)) {
+                coveredEdges[i] = true;
+            }
+        }
+    }
+
+    return cover;
+}
+
+// Корзины остаточных степеней для жадного выбора вершины наибольшей степени. Хранится остаточная
+// степень каждой вершины (число соседей вне покрытия); при взятии вершины степени соседей уменьшаются,
+// и сосед дописывается в корзину новой степени, старая запись устаревает.
+// Степени только убывают, поэтому в корзину текущей максимальной степени никто не добавляется:
+// когда она становится максимальной, из неё отбираются действительные записи и упорядочиваются
+// по номерам, дальше выбор идёт курсором — при равной степени берётся меньший номер, как в greedyVertexCover.
+// Упорядочивание — поразрядная сортировка в два прохода по основанию B ≈ √V (мелкие корзины — std::sort),
+// O(k + B) для k записей. Сортируются только уровни, с которых берётся вершина этой степени, а сумма
+// таких различных степеней не больше E, поэтому уровней не больше √(2E), и вся сортировка стоит
+// O(V + E + √V · √(2E)) = O(V + E).
+class DegreeBuckets {
+public:
+    explicit DegreeBuckets(const CsrGraph& graph) : graph(graph), degree(graph.V), inCover(graph.V, 0) {
+        int maxDegree = 0;
+        for (int u = 0; u < graph.V; ++u) {
+            degree[u] = graph.degree(u);
+            maxDegree = std::max(maxDegree, degree[u]);
+            for (int v : graph.neighborsOf(u)) {
+                if (u < v) {
+                    uncovered++;
+                }
+            }
+        }
+        buckets.resize(maxDegree + 1);
+        for (int v = 0; v < graph.V; ++v) {
+            buckets[degree[v]].push_back(v);
+        }
+        top = maxDegree;
+
+        int bits = 1;
+        while (bits < 31 && (1 << bits) < graph.V) ++bits;
+        lowBits = (bits + 1) / 2;
+        count.resize(std::size_t(1) << lowBits);
+    }
+
+    long long uncoveredEdges() const { return uncovered; }
+
+    // Вершина с наибольшей остаточной степенью и наименьшим номером; вызывается, пока есть непокрытые рёбра
+    int pick() {
+        while (true) {
+            std::vector<int> &bucket = buckets[top];
+            if (!topSorted) {
+                sortValid(bucket);
+                position = 0;
+                topSorted = true;
+            }
+            while (position < bucket.size()) {
+                int v = bucket[position++];
+                if (!inCover[v] && degree[v] == top) {
+                    return v;
+                }
+            }
+            std::vector<int>().swap(bucket);
+            --top;
+            topSorted = false;
+        }
+    }
+
+    // Вершина в покрытии: рёбра к соседям вне покрытия покрыты, степени соседей уменьшаются
+    void take(int v) {
+        inCover[v] = 1;
+        for (int neighbor : graph.neighborsOf(v)) {
+            if (inCover[neighbor]) continue;
+            uncovered--;
+            buckets[--degree[neighbor]].push_back(neighbor);
+        }
+    }
+
+private:
+    // Действительные записи корзины top по возрастанию номеров; повторов нет — вершина попадает
+    // в корзину степени d не больше одного раза
+    void sortValid(std::vector<int> &bucket) {
+        std::size_t valid = 0;
+        for (int v : bucket) {
+            if (!inCover[v] && degree[v] == top) {
+                bucket[valid++] = v;
+            }
+        }
+        bucket.resize(valid);
+        if (valid * 16 < count.size()) {
+            std::sort(bucket.begin(), bucket.end());
+            return;
+        }
+        scratch.resize(valid);
+        radixPass(bucket, scratch, 0);
+        radixPass(scratch, bucket, lowBits);
+    }
+
+    void radixPass(const std::vector<int> &from, std::vector<int> &to, int shift) {
+        int mask = (int) count.size() - 1;
+        std::fill(count.begin(), count.end(), 0);
+        for (int v : from) {
+            count[(v >> shift) & mask]++;
+        }
+        int sum = 0;
+        for (int &c : count) {
+            int size = c;
+            c = sum;
+            sum += size;
+        }
+        for (int v : from) {
+            to[count[(v >> shift) & mask]++] = v;
+        }
+    }
+
+    const CsrGraph& graph;
+    std::vector<int> degree;
+    std::vector<char> inCover;
+    std::vector<std::vector<int>> buckets;
+    std::vector<int> count;
+    std::vector<int> scratch;
+    long long uncovered = 0;
+    int top = 0;
+    int lowBits = 1;
+    std::size_t position = 0;
+    bool topSorted = false;
+};
+
+// Жадный алгоритм по максимальной степени на корзинах (DegreeBuckets): O(V + E), покрытие совпадает
+// с greedyVertexCover.
+inline std::unordered_set<int> bucketGreedyVertexCover(const CsrGraph& graph) {
+    std::unordered_set<int> cover;
+    DegreeBuckets buckets(graph);
+    while (buckets.uncoveredEdges() > 0) {
+        int v = buckets.pick();
+        cover.insert(v);
+        buckets.take(v);
+    }
+    return cover;
+}
+
+// Жадный алгоритм с инкрементальным учётом рёбер: вместо подсчёта непокрытых рёбер и просмотра
+// всего списка рёбер на каждом шаге хранится счётчик непокрытых рёбер, который уменьшается
+// при взятии вершины, так что шаг стоит O(deg) плюс амортизированный выбор по корзинам.
+// Выбор вершины — тот же DegreeBuckets, что в bucketGreedyVertexCover; отдельная функция нужна
+// для замера: pickCosts (если задан) получает для каждого шага степень выбранной вершины
+// и время шага в нс (выбор вершины и пометка рёбер).
+inline std::unordered_set<int> incrementalGreedyVertexCover(const CsrGraph& graph,
+                                                            std::vector<std::pair<int, long long>>* pickCosts = nullptr) {
+    std::unordered_set<int> cover;
+    DegreeBuckets buckets(graph);
+    while (buckets.uncoveredEdges() > 0) {
+        auto start = std::chrono::steady_clock::now();
+        int v = buckets.pick();
+        cover.insert(v);
+        buckets.take(v);
+        if (pickCosts) {
+            auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+            pickCosts->emplace_back(graph.degree(v), elapsed.count());
+        }
+    }
+    return cover;
+}
+
+// Приоритет ребра для параллельного паросочетания: перемешивание номера (splitmix64)
+inline uint64_t edgePriority(uint64_t edge, uint64_t seed) {
+    uint64_t x = edge + seed + 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+// 2-приближение через максимальное паросочетание (раунды в духе Luby/Blelloch, детерминированное резервирование).
+// Каждое живое ребро получает ключ (случайный приоритет, номер) и записывает минимум ключей в обе вершины;
+// ребро, чей ключ остался минимальным в обеих вершинах, входит в паросочетание. Затем рёбра
+// с занятыми концами удаляются, и раунд повторяется; раундов O(log E) с высокой вероятностью.
+// Результат совпадает с последовательным жадным паросочетанием в порядке приоритетов и не зависит
+// от числа потоков. Покрытие — оба конца каждого ребра паросочетания.
+inline std::unordered_set<int> matchingVertexCover(const CsrGraph& graph, ThreadPool& pool, uint64_t seed = 1) {
+    const uint64_t freeKey = UINT64_MAX;
+    int V = graph.V;
+    int tasks = pool.size() * 4;
+
+    // Список рёбер u < v: подсчёт по диапазонам вершин, затем заполнение
+    std::vector<long long> taskEdges(tasks + 1, 0);
+    pool.parallelFor(tasks, [&](int task) {
+        long long count = 0;
+        for (long long u = (long long) V * task / tasks; u < (long long) V * (task + 1) / tasks; ++u) {
+            for (int v : graph.neighborsOf(u)) {
+                if (u < v) count++;
+            }
+        }
+        taskEdges[task + 1] = count;
+    });
+    for (int task = 0; task < tasks; ++task) {
+        taskEdges[task + 1] += taskEdges[task];
+    }
+    std::vector<std::pair<int, int>> live(taskEdges[tasks]);
+    std::vector<uint32_t> liveIds(taskEdges[tasks]);
+    pool.parallelFor(tasks, [&](int task) {
+        long long position = taskEdges[task];
+        for (long long u = (long long) V * task / tasks; u < (long long) V * (task + 1) / tasks; ++u) {
+            for (int v : graph.neighborsOf(u)) {
+                if (u < v) {
+                    liveIds[position] = position;
+                    live[position++] = {(int) u, v};
+                }
+            }
+        }
+    });
+
+    std::vector<std::atomic<uint64_t>> reservation(V);
+    std::vector<char> matched(V, 0);
+    pool.parallelFor(tasks, [&](int task) {
+        for (long long v = (long long) V * task / tasks; v < (long long) V * (task + 1) / tasks; ++v) {
+            reservation[v].store(freeKey, std::memory_order_relaxed);
+        }
+    });
+
+    auto writeMin = [](std::atomic<uint64_t> &target, uint64_t key) {
+        uint64_t current = target.load(std::memory_order_relaxed);
+        while (key < current && !target.compare_exchange_weak(current, key, std::memory_order_relaxed)) {
+        }
+    };
+
+    std::vector<std::pair<int, int>> nextLive;
+    std::vector<uint32_t> nextIds;
+    std::vector<long long> taskLive(tasks + 1);
+    while (!live.empty()) {
+        long long liveCount = live.size();
+        auto key = [&](long long i) {
+            return (edgePriority(liveIds[i], seed) & 0xFFFFFFFF00000000ULL) | liveIds[i];
+        };
+
+        // Резервирование: минимум ключей инцидентных живых рёбер в каждой вершине
+        pool.parallelFor(tasks, [&](int task) {
+            for (long long i = liveCount * task / tasks; i < liveCount * (task + 1) / tasks; ++i) {
+                uint64_t k = key(i);
+                writeMin(reservation[live[i].first], k);
+                writeMin(reservation[live[i].second], k);
+            }
+        });
+
+        // Фиксация: ребро, выигравшее обе вершины; у вершины не больше одного победителя
+        pool.parallelFor(tasks, [&](int task) {
+            for (long long i = liveCount * task / tasks; i < liveCount * (task + 1) / tasks; ++i) {
+                uint64_t k = key(i);
+                auto [u, v] = live[i];
+                if (reservation[u].load(std::memory_order_relaxed) == k && reservation[v].load(std::memory_order_relaxed) == k) {
+                    matched[u] = 1;
+                    matched[v] = 1;
+                }
+            }
+        });
+
+        // Сброс резервирований и удаление рёбер с занятыми концами (с сохранением порядка)
+        pool.parallelFor(tasks, [&](int task) {
+            long long count = 0;
+            for (long long i = liveCount * task / tasks; i < liveCount * (task + 1) / tasks; ++i) {
+                auto [u, v] = live[i];
+                reservation[u].store(freeKey, std::memory_order_relaxed);
+                reservation[v].store(freeKey, std::memory_order_relaxed);
+                if (!matched[u] && !matched[v]) count++;
+            }
+            taskLive[task + 1] = count;
+        });
+        taskLive[0] = 0;
+        for (int task = 0; task < tasks; ++task) {
+            taskLive[task + 1] += taskLive[task];
+        }
+        nextLive.resize(taskLive[tasks]);
+        nextIds.resize(taskLive[tasks]);
+        pool.parallelFor(tasks, [&](int task) {
+            long long position = taskLive[task];
+            for (long long i = liveCount * task / tasks; i < liveCount * (task + 1) / tasks; ++i) {
+                auto [u, v] = live[i];
+                if (!matched[u] && !matched[v]) {
+                    nextIds[position] = liveIds[i];
+                    nextLive[position++] = live[i];
+                }
+            }
+        });
+        live.swap(nextLive);
+        liveIds.swap(nextIds);
+    }
+
+    std::unordered_set<int> cover;
+    for (int v = 0; v < V; ++v) {
+        if (matched[v]) {
+            cover.insert(v);
+        }
+    }
+    return cover;
+}
+
+// Локальный поиск в духе NuMVC/FastVC, начиная с жадного покрытия (bucketGreedyVertexCover даёт то же
+// покрытие, что greedyVertexCover, за линейное время). Веса рёбер растут, пока ребро не покрыто,
+// dscore вершины — изменение суммарного веса непокрытых рёбер при смене её состояния. Найдя покрытие,
+// алгоритм запоминает его и удаляет вершину; затем на каждом шаге меняет местами вершину из покрытия
+// (лучшая по dscore из 50 случайных) и конец случайного непокрытого ребра с учётом конфигурации:
+// вершина, соседи которой не менялись с её удаления, обратно не берётся.
+// Все структуры — массивы; непокрытые рёбра и покрытие хранятся списками с позициями, замена O(deg).
+// Работа прекращается по истечении timeLimit секунд; report вызывается каждые reportInterval секунд
+// и в конце с (время, размер лучшего покрытия, число шагов).
+inline std::unordered_set<int> localSearchVertexCover(const CsrGraph& graph, double timeLimit, double reportInterval,
+                                                      const std::function<void(double, int, long long)>& report, unsigned seed = 1) {
+    const int sampleSize = 50;
+    const double forgetRate = 0.3;
+    int V = graph.V;
+    auto start = std::chrono::steady_clock::now();
+
+    // Рёбра u < v и индекс инцидентных рёбер
+    std::vector<std::pair<int, int>> edges;
+    for (int u = 0; u < V; ++u) {
+        for (int v : graph.neighborsOf(u)) {
+            if (u < v) {
+                edges.emplace_back(u, v);
+            }
+        }
+    }
+    int E = edges.size();
+    std::vector<int> incidentOffsets(V + 1, 0);
+    for (const auto &[u, v] : edges) {
+        incidentOffsets[u + 1]++;
+        incidentOffsets[v + 1]++;
+    }
+    for (int v = 0; v < V; ++v) {
+        incidentOffsets[v + 1] += incidentOffsets[v];
+    }
+    std::vector<int> incident(incidentOffsets[V]);
+    std::vector<int> fillPos(incidentOffsets.begin(), incidentOffsets.end() - 1);
+    for (int i = 0; i < E; ++i) {
+        incident[fillPos[edges[i].first]++] = i;
+        incident[fillPos[edges[i].second]++] = i;
+    }
+
+    std::vector<char> inCover(V, 0);
+    std::vector<char> confChange(V, 1);
+    std::vector<long long> dscore(V, 0);
+    std::vector<long long> age(V, 0);
+    std::vector<int> edgeWeight(E, 1);
+    std::vector<int> coverList;
+    std::vector<int> coverPos(V, -1);
+    std::vector<int> uncovered;
+    std::vector<int> uncoveredPos(E, -1);
+    long long totalWeight = E;
+
+    auto listAdd = [](std::vector<int> &list, std::vector<int> &pos, int item) {
+        pos[item] = list.size();
+        list.push_back(item);
+    };
+    auto listRemove = [](std::vector<int> &list, std::vector<int> &pos, int item) {
+        int last = list.back();
+        list[pos[item]] = last;
+        pos[last] = pos[item];
+        list.pop_back();
+        pos[item] = -1;
+    };
+
+    auto addVertex = [&](int v) {
+        inCover[v] = 1;
+        dscore[v] = -dscore[v];
+        listAdd(coverList, coverPos, v);
+        for (int k = incidentOffsets[v]; k < incidentOffsets[v + 1]; ++k) {
+            int e = incident[k];
+            int x = edges[e].first ^ edges[e].second ^ v;
+            confChange[x] = 1;
+            if (inCover[x]) {
+                dscore[x] += edgeWeight[e];
+            } else {
+                dscore[x] -= edgeWeight[e];
+                listRemove(uncovered, uncoveredPos, e);
+            }
+        }
+    };
+    auto removeVertex = [&](int v) {
+        inCover[v] = 0;
+        confChange[v] = 0;
+        dscore[v] = -dscore[v];
+        listRemove(coverList, coverPos, v);
+        for (int k = incidentOffsets[v]; k < incidentOffsets[v + 1]; ++k) {
+            int e = incident[k];
+            int x = edges[e].first ^ edges[e].second ^ v;
+            confChange[x] = 1;
+            if (inCover[x]) {
+                dscore[x] -= edgeWeight[e];
+            } else {
+                dscore[x] += edgeWeight[e];
+                listAdd(uncovered, uncoveredPos, e);
+            }
+        }
+    };
+    auto recomputeScores = [&]() {
+        std::fill(dscore.begin(), dscore.end(), 0);
+        for (int e = 0; e < E; ++e) {
+            auto [u, v] = edges[e];
+            if (!inCover[u] && !inCover[v]) {
+                dscore[u] += edgeWeight[e];
+                dscore[v] += edgeWeight[e];
+            } else if (inCover[u] != inCover[v]) {
+                dscore[inCover[u] ? u : v] -= edgeWeight[e];
+            }
+        }
+    };
+
+    // Начальное покрытие: все рёбра покрыты, dscore считается по нему
+    for (int v : bucketGreedyVertexCover(graph)) {
+        inCover[v] = 1;
+        listAdd(coverList, coverPos, v);
+    }
+    recomputeScores();
+
+    std::vector<int> best = coverList;
+    // xorshift: генератор дешевле mt19937, выборка делается 50 раз за шаг
+    uint64_t state = seed * 0x9E3779B97F4A7C15ULL + 1;
+    auto random = [&](std::size_t bound) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return (std::size_t) ((state >> 32) * bound >> 32);
+    };
+    long long steps = 0;
+    double nextReport = reportInterval;
+    double elapsed = 0;
+
+    while (true) {
+        if ((steps & 1023) == 0) {
+            elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            if (elapsed >= timeLimit) break;
+            if (elapsed >= nextReport) {
+                report(elapsed, best.size(), steps);
+                nextReport += reportInterval;
+            }
+        }
+        ++steps;
+
+        if (uncovered.empty()) {
+            // Покрытие найдено: запоминается, и удаляется вершина с наибольшим dscore
+            if (coverList.size() < best.size()) {
+                best = coverList;
+            }
+            if (coverList.empty()) break;
+            int candidate = coverList[0];
+            for (int v : coverList) {
+                if (dscore[v] > dscore[candidate]) candidate = v;
+            }
+            removeVertex(candidate);
+            age[candidate] = steps;
+            continue;
+        }
+
+        // Удаление: лучшая по dscore из случайной выборки покрытия, при равенстве — дольше не менявшаяся
+        int removed = -1;
+        if (!coverList.empty()) {
+            for (int i = 0; i < sampleSize; ++i) {
+                int v = coverList[random(coverList.size())];
+                if (removed == -1 || dscore[v] > dscore[removed] || (dscore[v] == dscore[removed] && age[v] < age[removed])) {
+                    removed = v;
+                }
+            }
+            removeVertex(removed);
+            age[removed] = steps;
+        }
+
+        // Добавление: конец случайного непокрытого ребра, разрешённый проверкой конфигурации
+        int e = uncovered[random(uncovered.size())];
+        auto [a, b] = edges[e];
+        int added;
+        if (!confChange[a]) {
+            added = b;
+        } else if (!confChange[b]) {
+            added = a;
+        } else {
+            added = dscore[a] > dscore[b] || (dscore[a] == dscore[b] && age[a] < age[b]) ? a : b;
+        }
+        addVertex(added);
+        age[added] = steps;
+
+        // Рост весов непокрытых рёбер; при большом среднем весе веса «забываются»
+        for (int f : uncovered) {
+            edgeWeight[f]++;
+            dscore[edges[f].first]++;
+            dscore[edges[f].second]++;
+        }
+        totalWeight += uncovered.size();
+        if (totalWeight > (long long) E * std::max(2, V / 2)) {
+            totalWeight = 0;
+            for (int f = 0; f < E; ++f) {
+                edgeWeight[f] = std::max(1, (int) (edgeWeight[f] * forgetRate));
+                totalWeight += edgeWeight[f];
+            }
+            recomputeScores();
+        }
+    }
+
+    report(elapsed, best.size(), steps);
+    return std::unordered_set<int>(best.begin(), best.end());
+}
+
+// Точный метод ветвей и границ для небольших графов и ядер. Множества вершин — битовые массивы.
+// В узле: вершины без рёбер отбрасываются, сосед вершины степени 1 берётся; нижняя граница —
+// максимум из жадного паросочетания и покрытия кликами (клика из k вершин требует k - 1 вершину).
+// Ветвление по вершине v наибольшей степени: v в покрытии, либо все её соседи в покрытии.
+// Верхние ветви (до spawnDepth) кладутся в очереди потоков; простаивающий поток забирает работу
+// из начала чужой очереди. Возвращает false, если за timeLimit секунд оптимум не доказан
+// (тогда cover — лучшее найденное покрытие).
+inline bool exactVertexCover(const CsrGraph& graph, ThreadPool& pool, std::unordered_set<int>& cover, double timeLimit) {
+    const int spawnDepth = 12;
+    int V = graph.V;
+    int words = bitsetWords(V);
+    auto start = std::chrono::steady_clock::now();
+
+    std::unordered_set<int> greedy = bucketGreedyVertexCover(graph);
+    cover = greedy;
+    // Матрица смежности битами: V * V / 8 байт
+    if ((long long) V * words > (1LL << 25)) {
+        return false;
+    }
+
+    std::vector<uint64_t> adjacency((std::size_t) V * words, 0);
+    std::vector<uint64_t> selfLoops(words, 0);
+    for (int u = 0; u < V; ++u) {
+        for (int v : graph.neighborsOf(u)) {
+            if (u == v) {
+                selfLoops[u >> 6] |= uint64_t(1) << (u & 63);
+            } else {
+                adjacency[(std::size_t) u * words + (v >> 6)] |= uint64_t(1) << (v & 63);
+            }
+        }
+    }
+    auto neighbors = [&](int v) { return adjacency.data() + (std::size_t) v * words; };
+
+    struct Node {
+        std::vector<uint64_t> alive;  // нерешённые вершины
+        std::vector<uint64_t> taken;  // вершины, взятые в покрытие
+        int size;
+        int depth;
+    };
+
+    std::atomic<int> bestSize(greedy.size());
+    std::vector<uint64_t> bestTaken(words, 0);
+    for (int v : greedy) {
+        setBit(bestTaken, v);
+    }
+    std::mutex bestMutex;
+    std::atomic<bool> timedOut(false);
+
+    int threads = pool.size();
+    std::vector<std::deque<Node>> queues(threads);
+    std::unique_ptr<std::mutex[]> queueMutexes(new std::mutex[threads]);
+    std::atomic<long long> pending(1);
+
+    auto take = [&](Node &node, int v) {
+        clearBit(node.alive, v);
+        setBit(node.taken, v);
+        node.size++;
+    };
+
+    auto lowerBound = [&](const Node &node) {
+        int aliveCount = 0;
+        int matched = 0;
+        std::vector<uint64_t> free = node.alive;
+        std::vector<int> cliqueMembers;
+        std::vector<std::vector<uint64_t>> cliqueCandidates;
+        for (int w = 0; w < words; ++w) {
+            for (uint64_t bits = node.alive[w]; bits; bits &= bits - 1) {
+                int v = w * 64 + __builtin_ctzll(bits);
+                aliveCount++;
+                const uint64_t *nv = neighbors(v);
+                // Жадное паросочетание: первый свободный сосед
+                if (testBit(free.data(), v)) {
+                    for (int x = 0; x < words; ++x) {
+                        uint64_t candidates = nv[x] & free[x];
+                        if (candidates) {
+                            int u = x * 64 + __builtin_ctzll(candidates);
+                            clearBit(free, u);
+                            clearBit(free, v);
+                            matched++;
+                            break;
+                        }
+                    }
+                }
+                // Покрытие кликами: первая клика, все вершины которой смежны с v
+                bool placed = false;
+                for (auto &candidates : cliqueCandidates) {
+                    if (testBit(candidates.data(), v)) {
+                        for (int x = 0; x < words; ++x) {
+                            candidates[x] &= nv[x];
+                        }
+                        placed = true;
+                        break;
+                    }
+                }
+                if (!placed) {
+                    cliqueCandidates.emplace_back(nv, nv + words);
+                }
+            }
+        }
+        return std::max<int>(matched, aliveCount - cliqueCandidates.size());
+    };
+
+    // Обход в глубину с явным стеком: глубина ветвления доходит до V, рекурсия переполнила бы стек потока
+    auto search = [&](Node subtree, int thread) {
+        std::vector<Node> stack;
+        stack.push_back(std::move(subtree));
+        while (!stack.empty() && !timedOut.load(std::memory_order_relaxed)) {
+            Node node = std::move(stack.back());
+            stack.pop_back();
+
+            // Степени 0 и 1 до неподвижной точки
+            int branchVertex = -1;
+            int branchDegree = 0;
+            bool changed = true;
+            while (changed) {
+                changed = false;
+                branchVertex = -1;
+                branchDegree = 0;
+                for (int w = 0; w < words; ++w) {
+                    for (uint64_t bits = node.alive[w]; bits; bits &= bits - 1) {
+                        int v = w * 64 + __builtin_ctzll(bits);
+                        if (!testBit(node.alive.data(), v)) continue;
+                        int degree = andPopcount(neighbors(v), node.alive.data(), words);
+                        if (degree == 0) {
+                            clearBit(node.alive, v);
+                        } else if (degree == 1) {
+                            for (int x = 0; x < words; ++x) {
+                                uint64_t neighbor = neighbors(v)[x] & node.alive[x];
+                                if (neighbor) {
+                                    take(node, x * 64 + __builtin_ctzll(neighbor));
+                                    break;
+                                }
+                            }
+                            changed = true;
+                        } else if (degree > branchDegree) {
+                            branchDegree = degree;
+                            branchVertex = v;
+                        }
+                    }
+                }
+            }
+
+            if (node.size >= bestSize.load()) continue;
+            if (branchVertex == -1) {
+                std::lock_guard<std::mutex> lock(bestMutex);
+                if (node.size < bestSize.load()) {
+                    bestSize.store(node.size);
+                    bestTaken = node.taken;
+                }
+                continue;
+            }
+            if (node.size + lowerBound(node) >= bestSize.load()) continue;
+            if (std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() > timeLimit) {
+                timedOut.store(true);
+                break;
+            }
+
+            // Ветвь «все соседи v в покрытии»
+            Node withNeighbors{node.alive, node.taken, node.size, node.depth + 1};
+            const uint64_t *nv = neighbors(branchVertex);
+            for (int x = 0; x < words; ++x) {
+                uint64_t chosen = nv[x] & node.alive[x];
+                withNeighbors.taken[x] |= chosen;
+                withNeighbors.alive[x] &= ~chosen;
+            }
+            clearBit(withNeighbors.alive, branchVertex);
+            withNeighbors.size += branchDegree;
+
+            // Ветвь «v в покрытии» — продолжается в этом потоке после ветви соседей
+            take(node, branchVertex);
+            node.depth++;
+            stack.push_back(std::move(node));
+
+            if (withNeighbors.depth <= spawnDepth) {
+                pending.fetch_add(1);
+                std::lock_guard<std::mutex> lock(queueMutexes[thread]);
+                queues[thread].push_back(std::move(withNeighbors));
+            } else {
+                stack.push_back(std::move(withNeighbors));
+            }
+        }
+    };
+
+    Node root{std::vector<uint64_t>(words, 0), selfLoops, 0, 0};
+    for (int v = 0; v < V; ++v) {
+        if (!testBit(selfLoops.data(), v)) {
+            setBit(root.alive, v);
+        } else {
+            root.size++;
+        }
+    }
+    queues[0].push_back(std::move(root));
+
+    pool.parallelFor(threads, [&](int thread) {
+        while (pending.load() > 0) {
+            Node node;
+            bool found = false;
+            {
+                // Своя очередь — с конца (глубже), чужие — с начала (крупные поддеревья)
+                std::lock_guard<std::mutex> lock(queueMutexes[thread]);
+                if (!queues[thread].empty()) {
+                    node = std::move(queues[thread].back());
+                    queues[thread].pop_back();
+                    found = true;
+                }
+            }
+            for (int other = 1; other < threads && !found; ++other) {
+                int victim = (thread + other) % threads;
+                std::lock_guard<std::mutex> lock(queueMutexes[victim]);
+                if (!queues[victim].empty()) {
+                    node = std::move(queues[victim].front());
+                    queues[victim].pop_front();
+                    found = true;
+                }
+            }
+            if (!found) {
+                std::this_thread::yield();
+                continue;
+            }
+            search(std::move(node), thread);
+            pending.fetch_sub(1);
+        }
+    });
+
+    cover.clear();
+    for (int v = 0; v < V; ++v) {
+        if (testBit(bestTaken.data(), v)) {
+            cover.insert(v);
+        }
+    }
+    return !timedOut.load();
+}
+
+// Жадный алгоритм по компонентам связности: компоненты решаются независимо на пуле потоков.
+// Жадные алгоритмы не связывают компоненты между собой, поэтому покрытие совпадает с решением
+// на всём графе, а каждый шаг просматривает только свою компоненту. Сводка разбиения — в stats.
+inline std::unordered_set<int> componentVertexCover(const CsrGraph& graph, ThreadPool& pool,
+                                                   std::unordered_set<int> (*solver)(const CsrGraph&),
+                                                   ComponentStats *stats = nullptr) {
+    GraphComponents components = splitComponents(graph, pool);
+    if (stats) {
+        *stats = componentStats(components);
+    }
+    std::vector<int> cover = solveComponents(components, pool, solver);
+    return std::unordered_set<int>(cover.begin(), cover.end());
+}
+
+#endif // VC_SOLVERS_H
@@ -1,10 +1,16 @@
 #include <iostream>
 #include <vector>
-#include <set>
 #include <unordered_set>
 #include <algorithm>
 #include <random>
 #include <chrono>
+#include <string>
+#include <cstdlib>
+
+#include "set_system.h"
+#include "binary_format.h"
+#include "text_parser.h"
+#include "orlib_reader.h"
 
 using namespace std::chrono;
 
@@ -32,7 +38,7 @@ std::vector<Individual> initializePopulation(int populationSize, int setSize) {
 }
 
 // Оценка пригодности (fitness) индивидуума
-int evaluateFitness(const Individual &individual, const std::vector<std::set<int>> &sets, int n) {
+int evaluateFitness(const Individual &individual, const SetSystem &sets, int n) {
     std::unordered_set<int> covered;
     for (int i = 0; i < individual.chromosome.size(); ++i) {
         if (individual.chromosome[i]) {
@@ -45,7 +51,7 @@ int evaluateFitness(const Individual &individual, const std::vector<std::set<int
 }
 
 // Оценка пригодности для всей популяции
-void evaluatePopulation(std::vector<Individual> &population, const std::vector<std::set<int>> &sets, int n) {
+void evaluatePopulation(std::vector<Individual> &population, const SetSystem &sets, int n) {
     for (auto &individual : population) {
         individual.fitness = evaluateFitness(individual, sets, n);
     }
@@ -82,7 +88,7 @@ void mutate(Individual &individual) {
 }
 
 // Основная функция генетического алгоритма
-Individual geneticAlgorithm(const std::vector<std::set<int>> &sets, int n, int populationSize, int generations) {
+Individual geneticAlgorithm(const SetSystem &sets, int n, int populationSize, int generations) {
     auto population = initializePopulation(populationSize, sets.size());
     evaluatePopulation(population, sets, n);
 
@@ -107,31 +113,81 @@ Individual geneticAlgorithm(const std::vector<std::set<int>> &sets, int n, int p
     });
 }
 
-int main() {
-    int n, m;
-    std::cout << "Enter number of elements:";
-    std::cin >> n;
-    std::cout << "Enter number of sets:";
-    std::cin >> m;
+// Семейство множеств из последовательности чисел в формате ввода: n m, затем размер и элементы каждого множества
+bool setSystemFromIntegers(const std::vector<int> &values, SetSystem &sets, int &n) {
+    if (values.size() < 2 || values[1] < 0) {
+        std::cout << "Missing or invalid header (n m)" << std::endl;
+        return false;
+    }
+    n = values[0];
+    int m = values[1];
+    sets = SetSystem();
+    sets.reserve(m, values.size() - 2 > (std::size_t) m ? values.size() - 2 - m : 0);
 
-    std::vector<std::set<int>> sets(m);
+    std::size_t position = 2;
     for (int i = 0; i < m; ++i) {
-        int setSize;
-        std::cout << "Enter size of set " << i + 1 << ": ";
-        std::cin >> setSize;
-        std::cout << "Enter elements of set " << i + 1 << ": ";
-        for (int j = 0; j < setSize; ++j) {
-            int element;
-            std::cin >> element;
-            sets[i].insert(element);
+        if (position >= values.size() || values[position] < 0 || values.size() - position - 1 < (std::size_t) values[position]) {
+            std::cout << "Set " << i + 1 << " is truncated" << std::endl;
+            return false;
         }
+        int setSize = values[position++];
+        sets.addSet(values.data() + position, values.data() + position + setSize);
+        position += setSize;
     }
+    return true;
+}
 
+int main(int argc, char *argv[]) {
+    int n;
+    SetSystem sets;
     int populationSize, generations;
-    std::cout << "Enter population size:";
-    std::cin >> populationSize;
-    std::cout << "Enter number of generations:";
-    std::cin >> generations;
+
+    std::string inputFlag = argc >= 3 ? argv[1] : "";
+    if (inputFlag == "--binary" || inputFlag == "--text" || inputFlag == "--orlib") {
+        // Экземпляр из файла: genetic_algorithm --binary|--text|--orlib <файл> [размер популяции] [число поколений]
+        bool loaded;
+        if (inputFlag == "--binary") {
+            loaded = loadSetSystemBinary(argv[2], sets, n);
+        } else if (inputFlag == "--orlib") {
+            ThreadPool pool;
+            loaded = loadOrLibrary(argv[2], sets, n, pool);
+        } else {
+            ThreadPool pool;
+            std::vector<int> values;
+            loaded = parseIntegerFile(argv[2], values, pool) && setSystemFromIntegers(values, sets, n);
+        }
+        if (!loaded) {
+            return 1;
+        }
+        populationSize = argc >= 4 ? std::atoi(argv[3]) : 50;
+        generations = argc >= 5 ? std::atoi(argv[4]) : 100;
+    } else {
+        int m;
+        std::cout << "Enter number of elements:";
+        std::cin >> n;
+        std::cout << "Enter number of sets:";
+        std::cin >> m;
+
+        std::vector<int> setElements;
+        for (int i = 0; i < m; ++i) {
+            int setSize;
+            std::cout << "Enter size of set " << i + 1 << ": ";
+            std::cin >> setSize;
+            std::cout << "Enter elements of set " << i + 1 << ": ";
+            setElements.clear();
+            for (int j = 0; j < setSize; ++j) {
+                int element;
+                std::cin >> element;
+                setElements.push_back(element);
+            }
+            sets.addSet(setElements);
+        }
+
+        std::cout << "Enter population size:";
+        std::cin >> populationSize;
+        std::cout << "Enter number of generations:";
+        std::cin >> generations;
+    }
 
     auto start = high_resolution_clock::now();
     Individual result = geneticAlgorithm(sets, n, populationSize, generations);
@@ -8,6 +8,8 @@
 #include <fstream>
 #include <cmath>
 
+#include "set_system.h"
+
 using namespace std::chrono;
 
 struct Individual {
@@ -31,7 +33,7 @@ std::vector<Individual> initializePopulation(int populationSize, int setSize) {
     return population;
 }
 
-int evaluateFitness(const Individual &individual, const std::vector<std::set<int>> &sets, int n) {
+int evaluateFitness(const Individual &individual, const SetSystem &sets, int n) {
     std::unordered_set<int> covered;
     for (int i = 0; i < individual.chromosome.size(); ++i) {
         if (individual.chromosome[i]) {
@@ -43,7 +45,7 @@ int evaluateFitness(const Individual &individual, const std::vector<std::set<int
     return covered.size() == n ? covered.size() - std::count(individual.chromosome.begin(), individual.chromosome.end(), true) : -1;
 }
 
-void evaluatePopulation(std::vector<Individual> &population, const std::vector<std::set<int>> &sets, int n) {
+void evaluatePopulation(std::vector<Individual> &population, const SetSystem &sets, int n) {
     for (auto &individual : population) {
         individual.fitness = evaluateFitness(individual, sets, n);
     }
@@ -76,7 +78,7 @@ void mutate(Individual &individual) {
     individual.chromosome[mutationPoint] = !individual.chromosome[mutationPoint];
 }
 
-Individual geneticAlgorithm(const std::vector<std::set<int>> &sets, int n, int populationSize, int generations) {
+Individual geneticAlgorithm(const SetSystem &sets, int n, int populationSize, int generations) {
     auto population = initializePopulation(populationSize, sets.size());
     evaluatePopulation(population, sets, n);
 
@@ -154,16 +156,18 @@ void generateClusterSets(int n, int m, std::vector<std::set<int>>& sets, int clu
 }
 
 void measurePerformance(int n, int m, int setType, int populationSize, int generations, std::ofstream& outputFile) {
-    std::vector<std::set<int>> sets(m);
+    std::vector<std::set<int>> generatedSets(m);
 
     if (setType == 1) {
-        generateRandomSets(n, m, sets);
+        generateRandomSets(n, m, generatedSets);
     } else if (setType == 2) {
-        generateGridSets(n, m, sets);
+        generateGridSets(n, m, generatedSets);
     } else if (setType == 3) {
-        generateClusterSets(n, m, sets, sqrt(n));
+        generateClusterSets(n, m, generatedSets, sqrt(n));
     }
 
+    SetSystem sets = SetSystem::fromSets(generatedSets);
+
     auto start = high_resolution_clock::now();
     Individual result = geneticAlgorithm(sets, n, populationSize, generations);
     auto end = high_resolution_clock::now();
@@ -1,89 +1,135 @@
 #include <iostream>
 #include <vector>
 #include <unordered_set>
-#include <algorithm>
-
-struct Graph {
-    int V, E;
-    std::vector<std::vector<int>> adj;
-
-    Graph(int V) : V(V), E(0) {
-        adj.resize(V);
-    }
-
-    void addEdge(int u, int v) {
-        adj[u].push_back(v);
-        adj[v].push_back(u);
-        E++;
+#include <string>
+#include <cstdlib>
+
+#include "binary_format.h"
+#include "csr_graph.h"
+#include "graph_components.h"
+#include "graph_reader.h"
+#include "text_parser.h"
+#include "vc_kernel.h"
+#include "vc_solvers.h"
+
+// Граф из последовательности чисел в формате ввода: V E, затем рёбра u v (с нуля)
+bool graphFromIntegers(const std::vector<int> &values, CsrGraph &graph, ThreadPool &pool) {
+    if (values.size() < 2 || values[0] < 0 || values[1] < 0 || values.size() - 2 < 2 * (std::size_t) values[1]) {
+        std::cout << "Missing header (V E) or edges" << std::endl;
+        return false;
     }
-};
-
-std::unordered_set<int> greedyVertexCover(Graph& graph) {
-    std::unordered_set<int> cover;
-    std::vector<bool> coveredEdges(graph.E, false);
-    std::vector<std::pair<int, int>> edges;
-
-    // Создаем список ребер
-    for (int u = 0; u < graph.V; ++u) {
-        for (int v : graph.adj[u]) {
-            if (u < v) {
-                edges.emplace_back(u, v);
-            }
+    int V = values[0];
+    int E = values[1];
+    EdgeList edgeList(V);
+    edgeList.edges.reserve(E);
+    for (int i = 0; i < E; ++i) {
+        int u = values[2 + 2 * i];
+        int v = values[3 + 2 * i];
+        if (u < 0 || u >= V || v < 0 || v >= V) {
+            std::cout << "Edge " << i + 1 << " has an endpoint out of range" << std::endl;
+            return false;
         }
+        edgeList.addEdge(u, v);
     }
+    graph = buildCsrGraph(edgeList, pool);
+    return true;
+}
 
-    while (std::count(coveredEdges.begin(), coveredEdges.end(), false) > 0) {
-        int maxDegreeVertex = -1;
-        int maxDegree = -1;
-
-        // Находим вершину с наибольшей степенью (количеством непокрытых соседей)
-        for (int i = 0; i < graph.V; ++i) {
-            if (cover.count(i)) continue;
-            int degree = 0;
-            for (int neighbor : graph.adj[i]) {
-                if (!cover.count(neighbor)) {
-                    degree++;
-                }
+int main(int argc, char *argv[]) {
+    ThreadPool pool;
+    CsrGraph graph;
+    int mode = 1;
+    int useKernel = 0;
+    double timeLimit = 10;
+    std::string inputFlag = argc >= 3 ? argv[1] : "";
+    GraphFormat format;
+
+    if (inputFlag == "--binary" || inputFlag == "--text" || graphFormatFromFlag(inputFlag, format)) {
+        // Экземпляр из файла: greedy_cover --binary|--text|--dimacs|--metis|--snap <файл> [алгоритм]
+        // [1 — сведение к ядру] [время поиска, с] (время — для локального поиска и точного метода)
+        if (graphFormatFromFlag(inputFlag, format)) {
+            if (!loadGraphFile(argv[2], format, "", graph, pool)) {
+                return 1;
             }
-
-            if (degree > maxDegree) {
-                maxDegree = degree;
-                maxDegreeVertex = i;
+        } else if (inputFlag == "--binary") {
+            if (!loadGraphBinary(argv[2], graph)) {
+                return 1;
+            }
+        } else {
+            std::vector<int> values;
+            if (!parseIntegerFile(argv[2], values, pool) || !graphFromIntegers(values, graph, pool)) {
+                return 1;
             }
         }
+        mode = argc >= 4 ? std::atoi(argv[3]) : 1;
+        useKernel = argc >= 5 ? std::atoi(argv[4]) : 0;
+        timeLimit = argc >= 6 ? std::atof(argv[5]) : timeLimit;
+    } else {
+        int V;
+        int E;
+        std::cout << "Enter number of vertices:";
+        std::cin >> V;
+        std::cout << "Enter number of edges:";
+        std::cin >> E;
+
+        EdgeList edgeList(V);
+
+        std::cout << "\nEnter the edges (u v) format:" << std::endl;
+        for (int i = 0; i < E; ++i) {
+            int u, v;
+            std::cin >> u >> v;
+            edgeList.addEdge(u, v);
+        }
+        graph = buildCsrGraph(edgeList, pool);
 
-        // Добавляем вершину с наибольшей степенью в покрытие
-        cover.insert(maxDegreeVertex);
-
-        // Отмечаем все инцидентные ребра как покрытые
-        for (int i = 0; i < edges.size(); ++i) {
-            if (!coveredEdges[i] && (edges[i].first == maxDegreeVertex || edges[i].second == maxDegreeVertex)) {
-                coveredEdges[i] = true;
-            }
+        std::cout << "Select algorithm (1 - greedy, 2 - bucket greedy, 3 - incremental greedy, 4 - parallel matching, 5 - local search, 6 - exact):";
+        std::cin >> mode;
+        if (mode == 5 || mode == 6) {
+            std::cout << "Enter time limit (seconds):";
+            std::cin >> timeLimit;
         }
+        std::cout << "Reduce to kernel first (0 - no, 1 - yes):";
+        std::cin >> useKernel;
     }
 
-    return cover;
-}
-
-int main() {
-    int V;
-    int E;
-    std::cout << "Enter number of vertices:";
-    std::cin >> V;
-    std::cout << "Enter number of edges:";
-    std::cin >> E;
-
-    Graph graph(V);
-
-    std::cout << "\nEnter the edges (u v) format:" << std::endl;
-    for (int i = 0; i < E; ++i) {
-        int u, v;
-        std::cin >> u >> v;
-        graph.addEdge(u, v);
+    // Алгоритм решает ядро, покрытие поднимается обратно в исходный граф
+    VertexCoverKernel kernel;
+    const CsrGraph *solved = &graph;
+    if (useKernel == 1) {
+        kernel = reduceVertexCover(graph, pool);
+        solved = &kernel.graph;
+        std::cout << "Kernel: " << kernel.graph.V << " vertices, " << kernel.graph.E << " edges (of " << graph.V << ", " << graph.E
+                  << "), reduction time: " << kernel.reductionTime << " us" << std::endl;
     }
 
-    std::unordered_set<int> cover = greedyVertexCover(graph);
+    std::unordered_set<int> cover;
+    ComponentStats components;
+    if (mode == 2) {
+        cover = componentVertexCover(*solved, pool, bucketGreedyVertexCover, &components);
+    } else if (mode == 3) {
+        cover = componentVertexCover(*solved, pool, [](const CsrGraph& component) {
+            return incrementalGreedyVertexCover(component);
+        }, &components);
+    } else if (mode == 4) {
+        cover = matchingVertexCover(*solved, pool);
+    } else if (mode == 5) {
+        cover = localSearchVertexCover(*solved, timeLimit, 1.0, [](double seconds, int bestSize, long long steps) {
+            std::cout << "Local search: " << seconds << " s, best cover " << bestSize << ", steps " << steps << std::endl;
+        });
+    } else if (mode == 6) {
+        bool optimal = exactVertexCover(*solved, pool, cover, timeLimit);
+        std::cout << (optimal ? "Optimal cover found" : "Time limit reached, optimality not proven") << std::endl;
+    } else {
+        cover = componentVertexCover(*solved, pool, greedyVertexCover, &components);
+    }
+    if (mode < 4 || mode > 6) {
+        std::cout << "Components: " << components.components << " in " << components.parts << " parts, isolated vertices: " << components.isolated
+                  << ", decomposition time: " << components.decompositionTime << " us" << std::endl;
+    }
+    if (useKernel == 1) {
+        std::vector<int> lifted = kernel.lift(cover);
+        cover = std::unordered_set<int>(lifted.begin(), lifted.end());
+    }
 
     std::cout << "Vertex Cover: ";
     for (int v : cover) {
@@ -6,70 +6,16 @@
 #include <random>
 #include <cmath>
 #include <fstream>
+#include <thread>
 
-using namespace std::chrono;
-
-// Структура для представления графа
-struct Graph {
-    int V, E;
-    std::vector<std::vector<int>> adj;
-
-    Graph(int V) : V(V), E(0) {
-        adj.resize(V);
-    }
-
-    void addEdge(int u, int v) {
-        adj[u].push_back(v);
-        adj[v].push_back(u);
-        E++;
-    }
-};
-
-std::unordered_set<int> greedyVertexCover(Graph& graph) {
-    std::unordered_set<int> cover;
-    std::vector<bool> coveredEdges(graph.E, false);
-    std::vector<std::pair<int, int>> edges;
-
-    for (int u = 0; u < graph.V; ++u) {
-        for (int v : graph.adj[u]) {
-            if (u < v) {
-                edges.emplace_back(u, v);
-            }
-        }
-    }
-
-    while (std::count(coveredEdges.begin(), coveredEdges.end(), false) > 0) {
-        int maxDegreeVertex = -1;
-        int maxDegree = -1;
-
-        for (int i = 0; i < graph.V; ++i) {
-            if (cover.count(i)) continue;
-            int degree = 0;
-            for (int neighbor : graph.adj[i]) {
-                if (!cover.count(neighbor)) {
-                    degree++;
-                }
-            }
-
-            if (degree > maxDegree) {
-                maxDegree = degree;
-                maxDegreeVertex = i;
-            }
-        }
-
-        cover.insert(maxDegreeVertex);
-
-        for (int i = 0; i < edges.size(); ++i) {
-            if (!coveredEdges[i] && (edges[i].first == maxDegreeVertex || edges[i].second == maxDegreeVertex)) {
-                coveredEdges[i] = true;
-            }
-        }
-    }
+#include "csr_graph.h"
+#include "graph_components.h"
+#include "vc_kernel.h"
+#include "vc_solvers.h"
 
-    return cover;
-}
+using namespace std::chrono;
 
-void generateRandomGraph(Graph &graph, int E) {
+void generateRandomGraph(EdgeList &graph, int E) {
     std::random_device rd;
     std::mt19937 gen(rd());
     std::uniform_int_distribution<> dis(0, graph.V - 1);
@@ -85,7 +31,7 @@ void generateRandomGraph(Graph &graph, int E) {
     }
 }
 
-void generateGridGraph(Graph &graph, int rows, int cols) {
+void generateGridGraph(EdgeList &graph, int rows, int cols) {
     for (int r = 0; r < rows; ++r) {
         for (int c = 0; c < cols; ++c) {
             int v = r * cols + c;
@@ -95,7 +41,7 @@ void generateGridGraph(Graph &graph, int rows, int cols) {
     }
 }
 
-void generateClusterGraph(Graph &graph, int clusters, int clusterSize, int interClusterEdges) {
+void generateClusterGraph(EdgeList &graph, int clusters, int clusterSize, int interClusterEdges) {
     std::random_device rd;
     std::mt19937 gen(rd());
     std::uniform_int_distribution<> clusterDis(0, clusters - 1);
@@ -121,21 +67,39 @@ void generateClusterGraph(Graph &graph, int clusters, int clusterSize, int inter
     }
 }
 
-void measurePerformance(int V, int E, int graphType, std::ofstream &outputFile) {
-    Graph graph(V);
+// Проверка, что каждое ребро имеет конец в покрытии
+bool isVertexCover(const CsrGraph &graph, const std::unordered_set<int> &cover) {
+    for (int u = 0; u < graph.V; ++u) {
+        if (cover.count(u)) continue;
+        for (int v : graph.neighborsOf(u)) {
+            if (!cover.count(v)) return false;
+        }
+    }
+    return true;
+}
+
+CsrGraph generateGraph(int V, int E, int graphType, ThreadPool &pool, CsrBuildStats *stats = nullptr) {
+    EdgeList edgeList(V);
 
     if (graphType == 1) {
-        generateRandomGraph(graph, E);
+        generateRandomGraph(edgeList, E);
     } else if (graphType == 2) {
         int rows = std::sqrt(V);
         int cols = V / rows;
-        generateGridGraph(graph, rows, cols);
+        generateGridGraph(edgeList, rows, cols);
     } else if (graphType == 3) {
         int clusters = std::sqrt(V);
         int clusterSize = V / clusters;
         int interClusterEdges = E - (clusters * clusterSize * (clusterSize - 1) / 2);
-        generateClusterGraph(graph, clusters, clusterSize, interClusterEdges);
+        generateClusterGraph(edgeList, clusters, clusterSize, interClusterEdges);
     }
+    return buildCsrGraph(edgeList, pool, stats);
+}
+
+void measurePerformance(int V, int E, int graphType, ThreadPool &pool, std::ofstream &outputFile) {
+    // Случайный генератор повторяет рёбра, при построении они отбрасываются
+    CsrBuildStats buildStats;
+    CsrGraph graph = generateGraph(V, E, graphType, pool, &buildStats);
 
     auto start = high_resolution_clock::now();
     std::unordered_set<int> result = greedyVertexCover(graph);
@@ -144,33 +108,284 @@ void measurePerformance(int V, int E, int graphType, std::ofstream &outputFile)
     auto duration = duration_cast<microseconds>(end - start).count();
     int coverSize = result.size();
 
-    outputFile << V << "," << E << "," << graphType << "," << coverSize << "," << duration << "\n";
+    auto bucketStart = high_resolution_clock::now();
+    std::unordered_set<int> bucketResult = bucketGreedyVertexCover(graph);
+    auto bucketEnd = high_resolution_clock::now();
+
+    auto bucketDuration = duration_cast<microseconds>(bucketEnd - bucketStart).count();
+
+    auto incrementalStart = high_resolution_clock::now();
+    std::unordered_set<int> incrementalResult = incrementalGreedyVertexCover(graph);
+    auto incrementalEnd = high_resolution_clock::now();
+
+    auto incrementalDuration = duration_cast<microseconds>(incrementalEnd - incrementalStart).count();
+
+    auto matchingStart = high_resolution_clock::now();
+    std::unordered_set<int> matchingResult = matchingVertexCover(graph, pool);
+    auto matchingEnd = high_resolution_clock::now();
+
+    auto matchingDuration = duration_cast<microseconds>(matchingEnd - matchingStart).count();
+
+    // Жадный алгоритм на ядре: время включает сведение и подъём покрытия
+    auto kernelStart = high_resolution_clock::now();
+    VertexCoverKernel kernel = reduceVertexCover(graph, pool);
+    std::vector<int> kernelLifted = kernel.lift(greedyVertexCover(kernel.graph));
+    std::unordered_set<int> kernelResult(kernelLifted.begin(), kernelLifted.end());
+    auto kernelEnd = high_resolution_clock::now();
+
+    auto kernelDuration = duration_cast<microseconds>(kernelEnd - kernelStart).count();
+
+    outputFile << V << "," << E << "," << graphType << "," << coverSize << "," << duration << "," << bucketResult.size() << "," << bucketDuration
+               << "," << incrementalResult.size() << "," << incrementalDuration << "," << matchingResult.size() << "," << matchingDuration
+               << "," << kernel.graph.V << "," << kernel.graph.E << "," << kernel.reductionTime << "," << kernelResult.size() << "," << kernelDuration
+               << "," << buildStats.duplicateEdges << "\n";
 
     std::cout << "Vertices: " << V << ", Edges: " << E << ", GraphType: " << graphType << ", CoverSize: " << coverSize << ", ExecutionTime: " << duration << " us" << std::endl;
+    std::cout << "Graph built with " << graph.E << " edges, duplicate edges dropped: " << buildStats.duplicateEdges << std::endl;
+    std::cout << "Bucket greedy CoverSize: " << bucketResult.size() << ", ExecutionTime: " << bucketDuration << " us" << std::endl;
+    if (bucketResult != result) {
+        std::cout << "Bucket greedy cover differs from greedy cover!" << std::endl;
+    }
+    std::cout << "Incremental greedy CoverSize: " << incrementalResult.size() << ", ExecutionTime: " << incrementalDuration << " us" << std::endl;
+    if (incrementalResult != result) {
+        std::cout << "Incremental greedy cover differs from greedy cover!" << std::endl;
+    }
+    std::cout << "Matching CoverSize: " << matchingResult.size() << ", ExecutionTime: " << matchingDuration << " us" << std::endl;
+    if (!isVertexCover(graph, matchingResult)) {
+        std::cout << "Matching result is not a vertex cover!" << std::endl;
+    }
+    std::cout << "Kernel: " << kernel.graph.V << " vertices, " << kernel.graph.E << " edges, ReductionTime: " << kernel.reductionTime
+              << " us, Kernel greedy CoverSize: " << kernelResult.size() << ", ExecutionTime: " << kernelDuration << " us" << std::endl;
+    if (!isVertexCover(graph, kernelResult)) {
+        std::cout << "Kernel greedy result is not a vertex cover!" << std::endl;
+    }
+}
+
+// Локальный поиск с ограничением времени: лучший размер покрытия каждые 0.1 с
+void measureLocalSearch(int V, int E, int graphType, double timeLimit, ThreadPool &pool, std::ofstream &outputFile) {
+    CsrGraph graph = generateGraph(V, E, graphType, pool);
+    int greedySize = bucketGreedyVertexCover(graph).size();
+
+    long long totalSteps = 0;
+    std::unordered_set<int> result = localSearchVertexCover(graph, timeLimit, 0.1, [&](double seconds, int bestSize, long long steps) {
+        outputFile << V << "," << E << "," << graphType << "," << seconds << "," << bestSize << "," << steps << "\n";
+        totalSteps = steps;
+    });
+
+    std::cout << "Vertices: " << V << ", Edges: " << E << ", GraphType: " << graphType << ", GreedyCoverSize: " << greedySize
+              << ", LocalSearchCoverSize: " << result.size() << ", StepsPerSecond: " << (long long) (totalSteps / timeLimit) << std::endl;
+    if (!isVertexCover(graph, result)) {
+        std::cout << "Local search result is not a vertex cover!" << std::endl;
+    }
+}
+
+// Разрыв между жадным и оптимальным покрытием
+void measureExact(int V, int E, int graphType, double timeLimit, ThreadPool &pool, std::ofstream &outputFile) {
+    CsrGraph graph = generateGraph(V, E, graphType, pool);
+    int greedySize = bucketGreedyVertexCover(graph).size();
+
+    std::unordered_set<int> result;
+    auto start = high_resolution_clock::now();
+    bool optimal = exactVertexCover(graph, pool, result, timeLimit);
+    auto end = high_resolution_clock::now();
+
+    auto duration = duration_cast<microseconds>(end - start).count();
+    double gap = result.empty() ? 0 : (double) (greedySize - (int) result.size()) / result.size();
+
+    outputFile << V << "," << E << "," << graphType << "," << greedySize << "," << result.size() << "," << optimal << "," << gap << "," << duration << "\n";
+
+    std::cout << "Vertices: " << V << ", Edges: " << E << ", GraphType: " << graphType << ", GreedyCoverSize: " << greedySize
+              << ", " << (optimal ? "OptimalCoverSize: " : "BestCoverSize (time limit): ") << result.size()
+              << ", Gap: " << gap * 100 << "%, ExecutionTime: " << duration << " us" << std::endl;
+    if (!isVertexCover(graph, result)) {
+        std::cout << "Exact result is not a vertex cover!" << std::endl;
+    }
+}
+
+// Ускорение параллельного паросочетания при росте числа потоков от 1 до числа ядер
+void measureMatchingSpeedup(int V, int E, int graphType, ThreadPool &pool, std::ofstream &outputFile) {
+    CsrGraph graph = generateGraph(V, E, graphType, pool);
+
+    int maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<int> threadCounts;
+    for (int threads = 1; threads < maxThreads; threads *= 2) {
+        threadCounts.push_back(threads);
+    }
+    threadCounts.push_back(maxThreads);
+
+    long long baseDuration = 0;
+    std::unordered_set<int> baseResult;
+    for (int threads : threadCounts) {
+        ThreadPool threadPool(threads);
+        auto start = high_resolution_clock::now();
+        std::unordered_set<int> result = matchingVertexCover(graph, threadPool);
+        auto end = high_resolution_clock::now();
+
+        long long duration = duration_cast<microseconds>(end - start).count();
+        if (threads == 1) {
+            baseDuration = duration;
+            baseResult = result;
+        }
+        double speedup = duration > 0 ? (double) baseDuration / duration : 0;
+
+        outputFile << V << "," << E << "," << graphType << "," << threads << "," << result.size() << "," << duration << "," << speedup << "\n";
+
+        std::cout << "Vertices: " << V << ", Edges: " << E << ", GraphType: " << graphType << ", Threads: " << threads
+                  << ", CoverSize: " << result.size() << ", ExecutionTime: " << duration << " us, Speedup: " << speedup << std::endl;
+        if (result != baseResult) {
+            std::cout << "Matching cover depends on the thread count!" << std::endl;
+        }
+    }
+}
+
+// Жадный алгоритм на корзинах по компонентам связности против решения на всём графе
+// при росте числа потоков; время по компонентам включает разбиение
+void measureComponentSpeedup(int V, int E, int graphType, ThreadPool &pool, std::ofstream &outputFile) {
+    CsrGraph graph = generateGraph(V, E, graphType, pool);
+
+    auto wholeStart = high_resolution_clock::now();
+    std::unordered_set<int> wholeResult = bucketGreedyVertexCover(graph);
+    auto wholeEnd = high_resolution_clock::now();
+    long long wholeDuration = duration_cast<microseconds>(wholeEnd - wholeStart).count();
+
+    int maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<int> threadCounts;
+    for (int threads = 1; threads < maxThreads; threads *= 2) {
+        threadCounts.push_back(threads);
+    }
+    threadCounts.push_back(maxThreads);
+
+    for (int threads : threadCounts) {
+        ThreadPool threadPool(threads);
+        auto start = high_resolution_clock::now();
+        GraphComponents components = splitComponents(graph, threadPool);
+        std::vector<int> cover = solveComponents(components, threadPool, bucketGreedyVertexCover);
+        auto end = high_resolution_clock::now();
+
+        long long duration = duration_cast<microseconds>(end - start).count();
+        double speedup = duration > 0 ? (double) wholeDuration / duration : 0;
+        std::unordered_set<int> result(cover.begin(), cover.end());
+
+        outputFile << V << "," << E << "," << graphType << "," << threads << "," << components.components << ","
+                   << components.decompositionTime << "," << wholeDuration << "," << duration << "," << speedup << "\n";
+
+        std::cout << "Vertices: " << V << ", Edges: " << E << ", GraphType: " << graphType << ", Threads: " << threads
+                  << ", Components: " << components.components << ", DecompositionTime: " << components.decompositionTime
+                  << " us, WholeGraphTime: " << wholeDuration << " us, ComponentTime: " << duration << " us, Speedup: " << speedup << std::endl;
+        if (result != wholeResult) {
+            std::cout << "Component cover differs from whole-graph cover!" << std::endl;
+        }
+    }
+}
+
+// Стоимость шага инкрементального жадного алгоритма в зависимости от степени выбранной вершины:
+// среднее время шага (выбор вершины и пометка рёбер) по шагам с одинаковой степенью
+void measurePickCost(int V, int E, int graphType, ThreadPool &pool, std::ofstream &outputFile) {
+    CsrGraph graph = generateGraph(V, E, graphType, pool);
+
+    std::vector<std::pair<int, long long>> pickCosts;
+    incrementalGreedyVertexCover(graph, &pickCosts);
+
+    std::vector<long long> picks;
+    std::vector<long long> totalTime;
+    for (const auto &[degree, time] : pickCosts) {
+        if ((std::size_t) degree >= picks.size()) {
+            picks.resize(degree + 1, 0);
+            totalTime.resize(degree + 1, 0);
+        }
+        picks[degree]++;
+        totalTime[degree] += time;
+    }
+
+    std::cout << "Vertices: " << V << ", Edges: " << E << ", GraphType: " << graphType << ", Picks: " << pickCosts.size() << std::endl;
+    for (std::size_t degree = 0; degree < picks.size(); ++degree) {
+        if (picks[degree] == 0) continue;
+        outputFile << V << "," << E << "," << graphType << "," << degree << "," << picks[degree] << "," << totalTime[degree] / picks[degree] << "\n";
+        std::cout << "  Degree: " << degree << ", Picks: " << picks[degree] << ", AveragePickTime: " << totalTime[degree] / picks[degree] << " ns" << std::endl;
+    }
 }
 
 int main() {
+    ThreadPool pool;
     std::ofstream outputFile("greedy_performance_data.csv");
-    outputFile << "Vertices,Edges,GraphType,CoverSize,ExecutionTime\n";
+    outputFile << "Vertices,Edges,GraphType,CoverSize,ExecutionTime,BucketCoverSize,BucketExecutionTime,IncrementalCoverSize,IncrementalExecutionTime,MatchingCoverSize,MatchingExecutionTime,KernelVertices,KernelEdges,ReductionTime,KernelCoverSize,KernelExecutionTime,DuplicateEdges\n";
 
     std::cout << "Small graph (10 vertices, 15 edges):" << std::endl;
-    measurePerformance(10, 15, 1, outputFile);
-    measurePerformance(10, 15, 2, outputFile);
-    measurePerformance(10, 15, 3, outputFile);
+    measurePerformance(10, 15, 1, pool, outputFile);
+    measurePerformance(10, 15, 2, pool, outputFile);
+    measurePerformance(10, 15, 3, pool, outputFile);
     std::cout << "-----------------------------" << std::endl;
 
     std::cout << "Medium graph (100 vertices, 500 edges):" << std::endl;
-    measurePerformance(100, 500, 1, outputFile);
-    measurePerformance(100, 500, 2, outputFile);
-    measurePerformance(100, 500, 3, outputFile);
+    measurePerformance(100, 500, 1, pool, outputFile);
+    measurePerformance(100, 500, 2, pool, outputFile);
+    measurePerformance(100, 500, 3, pool, outputFile);
     std::cout << "-----------------------------" << std::endl;
 
     std::cout << "Large graph (1000 vertices, 5000 edges):" << std::endl;
-    measurePerformance(1000, 5000, 1, outputFile);
-    measurePerformance(1000, 5000, 2, outputFile);
-    measurePerformance(1000, 5000, 3, outputFile);
+    measurePerformance(1000, 5000, 1, pool, outputFile);
+    measurePerformance(1000, 5000, 2, pool, outputFile);
+    measurePerformance(1000, 5000, 3, pool, outputFile);
 
     outputFile.close();
 
+    std::ofstream pickCostFile("greedy_pick_cost.csv");
+    pickCostFile << "Vertices,Edges,GraphType,Degree,Picks,AveragePickTime\n";
+
+    std::cout << "-----------------------------" << std::endl;
+    std::cout << "Pick cost by degree (incremental greedy):" << std::endl;
+    measurePickCost(1000, 5000, 1, pool, pickCostFile);
+    measurePickCost(1000, 5000, 3, pool, pickCostFile);
+    measurePickCost(100000, 500000, 1, pool, pickCostFile);
+
+    pickCostFile.close();
+
+    std::ofstream localSearchFile("local_search_progress.csv");
+    localSearchFile << "Vertices,Edges,GraphType,Time,BestCoverSize,Steps\n";
+
+    std::cout << "-----------------------------" << std::endl;
+    std::cout << "Local search (1 s budget):" << std::endl;
+    measureLocalSearch(1000, 5000, 1, 1.0, pool, localSearchFile);
+    measureLocalSearch(1000, 5000, 2, 1.0, pool, localSearchFile);
+    measureLocalSearch(1000, 5000, 3, 1.0, pool, localSearchFile);
+    measureLocalSearch(100000, 500000, 1, 1.0, pool, localSearchFile);
+
+    localSearchFile.close();
+
+    std::ofstream exactFile("exact_gap.csv");
+    exactFile << "Vertices,Edges,GraphType,GreedyCoverSize,ExactCoverSize,Optimal,Gap,ExecutionTime\n";
+
+    std::cout << "-----------------------------" << std::endl;
+    std::cout << "Greedy gap to optimum (Grid and Cluster):" << std::endl;
+    measureExact(10, 15, 2, 10.0, pool, exactFile);
+    measureExact(10, 15, 3, 10.0, pool, exactFile);
+    measureExact(100, 500, 2, 10.0, pool, exactFile);
+    measureExact(100, 500, 3, 10.0, pool, exactFile);
+    measureExact(1000, 5000, 2, 10.0, pool, exactFile);
+    measureExact(1000, 5000, 3, 10.0, pool, exactFile);
+
+    exactFile.close();
+
+    std::ofstream speedupFile("matching_speedup.csv");
+    speedupFile << "Vertices,Edges,GraphType,Threads,CoverSize,ExecutionTime,Speedup\n";
+
+    std::cout << "-----------------------------" << std::endl;
+    std::cout << "Parallel matching speedup:" << std::endl;
+    measureMatchingSpeedup(1000000, 5000000, 1, pool, speedupFile);
+    measureMatchingSpeedup(1000000, 2000000, 2, pool, speedupFile);
+
+    speedupFile.close();
+
+    std::ofstream componentFile("component_speedup.csv");
+    componentFile << "Vertices,Edges,GraphType,Threads,Components,DecompositionTime,WholeGraphTime,ComponentTime,Speedup\n";
+
+    std::cout << "-----------------------------" << std::endl;
+    std::cout << "Bucket greedy by connected components (fragmented graphs):" << std::endl;
+    // Случайный граф со средней степенью меньше 1 и кластеры без рёбер между ними
+    measureComponentSpeedup(1000000, 400000, 1, pool, componentFile);
+    measureComponentSpeedup(10000, 495000, 3, pool, componentFile);
+
+    componentFile.close();
+
     return 0;
 }
@@ -1,68 +1,168 @@
 #include <iostream>
 #include <vector>
-#include <set>
 #include <unordered_set>
-#include <algorithm>
+#include <string>
+#include <cstdlib>
 
-int main() {
-    int n, m;
-    std::cout << "Enter the number of elements (n): ";
-    std::cin >> n;
-    std::cout << "Enter the number of sets (m): ";
-    std::cin >> m;
-
-    std::vector<std::set<int>> sets(m);
-    std::vector<int> setSizes(m);
-    std::unordered_set<int> universalSet; // Универсальное множество (все элементы)
-
-    // Заполнение универсального множества
-    for (int i = 0; i < n; ++i) {
-        universalSet.insert(i);
+#include "set_system.h"
+#include "thread_pool.h"
+#include "binary_format.h"
+#include "text_parser.h"
+#include "orlib_reader.h"
+#include "set_cover.h"
+
+// Семейство множеств из последовательности чисел в формате ввода: n m, затем элементы каждого множества до -1
+bool setSystemFromIntegers(const std::vector<int> &values, SetSystem &sets, int &n) {
+    if (values.size() < 2) {
+        std::cout << "Missing header (n m)" << std::endl;
+        return false;
+    }
+    n = values[0];
+    int m = values[1];
+    sets = SetSystem();
+    if (m < 0) {
+        std::cout << "Invalid number of sets: " << m << std::endl;
+        return false;
     }
+    sets.reserve(m, values.size() - 2 > (std::size_t) m ? values.size() - 2 - m : 0);
 
-    // Ввод множеств
-    std::cout << "Enter the elements of each set (space-separated, terminated by -1):" << std::endl;
+    std::size_t position = 2;
     for (int i = 0; i < m; ++i) {
-        std::cout << "Set " << i + 1 << ": ";
-        int element;
-        while (std::cin >> element && element != -1) {
-            sets[i].insert(element);
+        std::size_t start = position;
+        while (position < values.size() && values[position] != -1) {
+            ++position;
         }
-        setSizes[i] = sets[i].size(); // Запись размера множества
+        if (position == values.size()) {
+            std::cout << "Set " << i + 1 << " is not terminated by -1" << std::endl;
+            return false;
+        }
+        sets.addSet(values.data() + start, values.data() + position);
+        ++position;
     }
+    return true;
+}
 
-    std::unordered_set<int> covered;
-    std::vector<int> cover;
+int main(int argc, char *argv[]) {
+    // Потоковый режим: greedy_set --stream <файл> [коэффициент уменьшения порога]
+    if (argc >= 3 && std::string(argv[1]) == "--stream") {
+        double factor = argc >= 4 ? std::atof(argv[3]) : 2.0;
+        if (factor <= 1.0) {
+            factor = 2.0;
+        }
+        std::vector<int> cover;
+        std::vector<StreamingPassStats> stats;
+        bool success = streamingSetCover(argv[2], cover, factor, stats);
 
-    // Жадный алгоритм покрытия множеств
-    while (covered.size() < n) {
-        int bestSet = -1;
-        int maxCover = 0;
-        // Поиск множества, покрывающего наибольшее количество непокрытых элементов
-        for (int i = 0; i < m; ++i) {
-            int currentCover = 0;
-            for (int element : sets[i]) {
-                if (covered.find(element) == covered.end()) {
-                    currentCover++;
-                }
-            }
-            if (currentCover > maxCover) {
-                maxCover = currentCover;
-                bestSet = i;
-            }
+        for (std::size_t pass = 0; pass < stats.size(); ++pass) {
+            const auto &s = stats[pass];
+            std::cout << "Pass " << pass + 1 << ": threshold " << s.threshold << ", picked " << s.picked
+                      << ", " << s.setsRead << " sets, " << s.elementsRead << " elements in " << s.seconds * 1000
+                      << " ms (" << (s.seconds > 0 ? s.elementsRead / s.seconds / 1e6 : 0) << " M elements/s, "
+                      << (s.seconds > 0 ? s.bytesRead / s.seconds / (1024 * 1024) : 0) << " MB/s)" << std::endl;
         }
 
-        // Если невозможно покрыть все элементы
-        if (bestSet == -1) {
+        if (!success) {
             std::cout << "Cannot cover all elements." << std::endl;
             return 1;
         }
 
-        // Добавление выбранного множества в покрытие
-        cover.push_back(bestSet);
-        for (int element : sets[bestSet]) {
-            covered.insert(element);
+        std::cout << "Selected sets to cover all elements: ";
+        for (int setIndex : cover) {
+            std::cout << setIndex + 1 << " ";
         }
+        std::cout << std::endl;
+        return 0;
+    }
+
+    int n, m;
+    SetSystem sets;
+    int mode = 1;
+    std::string inputFlag = argc >= 3 ? argv[1] : "";
+    bool fileInput = inputFlag == "--binary" || inputFlag == "--text" || inputFlag == "--orlib";
+
+    if (fileInput) {
+        // Экземпляр из файла: greedy_set --binary|--text|--orlib <файл> [алгоритм]
+        bool loaded;
+        if (inputFlag == "--binary") {
+            loaded = loadSetSystemBinary(argv[2], sets, n);
+        } else if (inputFlag == "--orlib") {
+            ThreadPool pool;
+            loaded = loadOrLibrary(argv[2], sets, n, pool);
+        } else {
+            ThreadPool pool;
+            std::vector<int> values;
+            loaded = parseIntegerFile(argv[2], values, pool) && setSystemFromIntegers(values, sets, n);
+        }
+        if (!loaded) {
+            return 1;
+        }
+        m = sets.size();
+        mode = argc >= 4 ? std::atoi(argv[3]) : 1;
+        // Текстовый формат разбирается как целые числа и стоимостей не содержит
+        if (mode == 6 && inputFlag == "--text") {
+            std::cout << "Weighted greedy needs set costs: convert the file with instance_converter sets and use --binary, or use --orlib" << std::endl;
+            return 1;
+        }
+    } else {
+        std::cout << "Enter the number of elements (n): ";
+        std::cin >> n;
+        std::cout << "Enter the number of sets (m): ";
+        std::cin >> m;
+
+        std::vector<int> setSizes(m);
+        std::unordered_set<int> universalSet; // Универсальное множество (все элементы)
+
+        // Заполнение универсального множества
+        for (int i = 0; i < n; ++i) {
+            universalSet.insert(i);
+        }
+
+        // Ввод множеств
+        std::cout << "Enter the elements of each set (space-separated, terminated by -1):" << std::endl;
+        std::vector<int> setElements;
+        for (int i = 0; i < m; ++i) {
+            std::cout << "Set " << i + 1 << ": ";
+            int element;
+            setElements.clear();
+            while (std::cin >> element && element != -1) {
+                setElements.push_back(element);
+            }
+            sets.addSet(setElements);
+            setSizes[i] = sets[i].size(); // Запись размера множества
+        }
+
+        std::cout << "Select algorithm (1 - greedy, 2 - lazy greedy, 3 - bucket greedy, 4 - bitset greedy, 5 - parallel greedy, 6 - weighted greedy): ";
+        std::cin >> mode;
+    }
+
+    std::vector<int> cover;
+    bool success;
+    if (mode == 2) {
+        success = lazyGreedySetCover(sets, n, cover);
+    } else if (mode == 3) {
+        success = bucketGreedySetCover(sets, n, cover);
+    } else if (mode == 4) {
+        success = bitsetGreedySetCover(sets, n, cover);
+    } else if (mode == 5) {
+        ThreadPool pool;
+        success = parallelGreedySetCover(sets, n, cover, pool);
+    } else if (mode == 6) {
+        // Стоимости множеств (в файлах --binary и --orlib они уже есть; без стоимостей — единичные)
+        if (!fileInput) {
+            std::cout << "Enter the cost of each set (space-separated): ";
+            sets.costs.resize(m);
+            for (int i = 0; i < m; ++i) {
+                std::cin >> sets.costs[i];
+            }
+        }
+        success = weightedGreedySetCover(sets, n, cover);
+    } else {
+        success = greedySetCover(sets, n, cover);
+    }
+
+    if (!success) {
+        std::cout << "Cannot cover all elements." << std::endl;
+        return 1;
     }
 
     std::cout << "Selected sets to cover all elements: ";
@@ -70,6 +170,9 @@ int main() {
         std::cout << setIndex + 1 << " ";
     }
     std::cout << std::endl;
+    if (sets.weighted()) {
+        std::cout << "Total cost: " << sets.totalCost(cover) << std::endl;
+    }
 
     return 0;
 }
@@ -1,12 +1,18 @@
 #include <iostream>
 #include <vector>
 #include <set>
-#include <unordered_set>
 #include <algorithm>
 #include <chrono>
 #include <random>
 #include <cmath>
 #include <fstream>
+#include <string>
+
+#include "set_system.h"
+#include "bitset_ops.h"
+#include "thread_pool.h"
+#include "orlib_reader.h"
+#include "set_cover.h"
 
 using namespace std::chrono;
 
@@ -84,52 +90,85 @@ void generateClusterSets(int n, int m, std::vector<std::set<int>>& sets, int clu
     }
 }
 
-void measurePerformance(int n, int m, int setType, std::ofstream &outputFile) {
-    std::vector<std::set<int>> sets(m);
+// Случайные стоимости множеств от 1 до 10
+void generateSetCosts(SetSystem &sets) {
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_int_distribution<> costDis(1, 10);
+
+    sets.costs.resize(sets.size());
+    for (double &cost : sets.costs) {
+        cost = costDis(gen);
+    }
+}
+
+void measurePerformance(int n, int m, int setType, ThreadPool &pool, std::ofstream &outputFile) {
+    std::vector<std::set<int>> generatedSets(m);
 
     if (setType == 1) {
-        generateRandomSets(n, m, sets);
+        generateRandomSets(n, m, generatedSets);
     } else if (setType == 2) {
-        generateGridSets(n, m, sets);
+        generateGridSets(n, m, generatedSets);
     } else if (setType == 3) {
-        generateClusterSets(n, m, sets, sqrt(n));
+        generateClusterSets(n, m, generatedSets, sqrt(n));
     }
 
-    auto start = high_resolution_clock::now();
+    SetSystem sets = SetSystem::fromSets(generatedSets);
+    generateSetCosts(sets);
 
-    std::unordered_set<int> covered;
+    auto start = high_resolution_clock::now();
     std::vector<int> cover;
+    bool success = greedySetCover(sets, n, cover);
+    auto end = high_resolution_clock::now();
+    auto duration = duration_cast<microseconds>(end - start);
 
-    while (covered.size() < n) {
-        int bestSet = -1;
-        int maxCover = 0;
-        for (int i = 0; i < m; ++i) {
-            int currentCover = 0;
-            for (int element : sets[i]) {
-                if (covered.find(element) == covered.end()) {
-                    currentCover++;
-                }
-            }
-            if (currentCover > maxCover) {
-                maxCover = currentCover;
-                bestSet = i;
-            }
-        }
+    auto lazyStart = high_resolution_clock::now();
+    std::vector<int> lazyCover;
+    bool lazySuccess = lazyGreedySetCover(sets, n, lazyCover);
+    auto lazyEnd = high_resolution_clock::now();
+    auto lazyDuration = duration_cast<microseconds>(lazyEnd - lazyStart);
 
-        if (bestSet == -1) {
-            std::cout << "Cannot cover all elements." << std::endl;
-            outputFile << n << "," << m << "," << setType << "," << 0 << "," << -1 << "\n";
-            return;
-        }
+    auto bucketStart = high_resolution_clock::now();
+    std::vector<int> bucketCover;
+    bool bucketSuccess = bucketGreedySetCover(sets, n, bucketCover);
+    auto bucketEnd = high_resolution_clock::now();
+    auto bucketDuration = duration_cast<microseconds>(bucketEnd - bucketStart);
 
-        cover.push_back(bestSet);
-        for (int element : sets[bestSet]) {
-            covered.insert(element);
-        }
+    auto bitsetStart = high_resolution_clock::now();
+    std::vector<int> bitsetCover;
+    bool bitsetSuccess = bitsetGreedySetCover(sets, n, bitsetCover);
+    auto bitsetEnd = high_resolution_clock::now();
+    auto bitsetDuration = duration_cast<microseconds>(bitsetEnd - bitsetStart);
+
+    auto parallelStart = high_resolution_clock::now();
+    std::vector<int> parallelCover;
+    bool parallelSuccess = parallelGreedySetCover(sets, n, parallelCover, pool);
+    auto parallelEnd = high_resolution_clock::now();
+    auto parallelDuration = duration_cast<microseconds>(parallelEnd - parallelStart);
+
+    auto weightedStart = high_resolution_clock::now();
+    std::vector<int> weightedCover;
+    bool weightedSuccess = weightedGreedySetCover(sets, n, weightedCover);
+    auto weightedEnd = high_resolution_clock::now();
+    auto weightedDuration = duration_cast<microseconds>(weightedEnd - weightedStart);
+
+    if (!success || !lazySuccess || !bucketSuccess || !bitsetSuccess || !parallelSuccess || !weightedSuccess) {
+        std::cout << "Cannot cover all elements." << std::endl;
+        outputFile << n << "," << m << "," << setType << "," << 0 << "," << -1 << "," << 0 << "," << -1
+                   << "," << 0 << "," << -1 << "," << 0 << "," << -1 << "," << 0 << "," << -1
+                   << "," << 0 << "," << 0 << "," << -1 << "," << 0 << "\n";
+        return;
     }
 
-    auto end = high_resolution_clock::now();
-    auto duration = duration_cast<microseconds>(end - start);
+    if (cover != lazyCover) {
+        std::cout << "Lazy greedy cover differs from greedy cover!" << std::endl;
+    }
+    if (cover != bitsetCover) {
+        std::cout << "Bitset greedy cover differs from greedy cover!" << std::endl;
+    }
+    if (cover != parallelCover) {
+        std::cout << "Parallel greedy cover differs from greedy cover!" << std::endl;
+    }
 
     std::cout << "Selected sets to cover all elements: ";
     for (int setIndex : cover) {
@@ -137,30 +176,140 @@ void measurePerformance(int n, int m, int setType, std::ofstream &outputFile) {
     }
     std::cout << std::endl;
     std::cout << "Execution time: " << duration.count() << " microseconds" << std::endl;
+    std::cout << "Lazy greedy execution time: " << lazyDuration.count() << " microseconds" << std::endl;
+    std::cout << "Bucket greedy execution time: " << bucketDuration.count() << " microseconds"
+              << " (cover size " << bucketCover.size() << ")" << std::endl;
+    std::cout << "Bitset greedy execution time: " << bitsetDuration.count() << " microseconds" << std::endl;
+    std::cout << "Parallel greedy execution time (" << pool.size() << " threads): " << parallelDuration.count()
+              << " microseconds" << std::endl;
+    std::cout << "Weighted greedy execution time: " << weightedDuration.count() << " microseconds"
+              << " (cover size " << weightedCover.size() << ", total cost " << sets.totalCost(weightedCover)
+              << " vs " << sets.totalCost(cover) << " for unweighted greedy)" << std::endl;
 
-    outputFile << n << "," << m << "," << setType << "," << duration.count() << "," << cover.size() << "\n";
+    outputFile << n << "," << m << "," << setType << "," << duration.count() << "," << cover.size() << ","
+               << lazyDuration.count() << "," << lazyCover.size() << ","
+               << bucketDuration.count() << "," << bucketCover.size() << ","
+               << bitsetDuration.count() << "," << bitsetCover.size() << ","
+               << parallelDuration.count() << "," << parallelCover.size() << ","
+               << sets.totalCost(cover) << "," << weightedDuration.count() << "," << weightedCover.size() << ","
+               << sets.totalCost(weightedCover) << "\n";
 }
 
-int main() {
+// Сравнение памяти CSR и std::vector<std::set<int>> для m множеств по setSize случайных элементов
+void measureMemory(int n, int m, int setSize) {
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<> dis(0, n - 1);
+
+    SetSystem sets;
+    sets.reserve(m, (std::size_t) m * setSize);
+    std::vector<int> setElements;
+    for (int i = 0; i < m; ++i) {
+        setElements.clear();
+        for (int j = 0; j < setSize; ++j) {
+            setElements.push_back(dis(gen));
+        }
+        sets.addSet(setElements);
+    }
+
+    std::cout << "Total elements: " << sets.totalSize() << ", CSR memory: " << sets.memoryBytes() / (1024 * 1024)
+              << " MB, tree memory (estimate): " << treeMemoryEstimate(sets) / (1024 * 1024) << " MB" << std::endl;
+}
+
+// Прогон на экземпляре OR-Library (scp*/rail*): загрузка, взвешенный, ленивый и корзинный жадные алгоритмы
+void measureOrLibrary(const std::string &path, ThreadPool &pool, std::ofstream &outputFile) {
+    auto loadStart = high_resolution_clock::now();
+    SetSystem sets;
+    int n;
+    if (!loadOrLibrary(path, sets, n, pool)) {
+        return;
+    }
+    auto loadEnd = high_resolution_clock::now();
+    auto loadDuration = duration_cast<microseconds>(loadEnd - loadStart);
+
+    auto weightedStart = high_resolution_clock::now();
+    std::vector<int> weightedCover;
+    bool weightedSuccess = weightedGreedySetCover(sets, n, weightedCover);
+    auto weightedEnd = high_resolution_clock::now();
+    auto weightedDuration = duration_cast<microseconds>(weightedEnd - weightedStart);
+
+    auto lazyStart = high_resolution_clock::now();
+    std::vector<int> lazyCover;
+    bool lazySuccess = lazyGreedySetCover(sets, n, lazyCover);
+    auto lazyEnd = high_resolution_clock::now();
+    auto lazyDuration = duration_cast<microseconds>(lazyEnd - lazyStart);
+
+    auto bucketStart = high_resolution_clock::now();
+    std::vector<int> bucketCover;
+    bool bucketSuccess = bucketGreedySetCover(sets, n, bucketCover);
+    auto bucketEnd = high_resolution_clock::now();
+    auto bucketDuration = duration_cast<microseconds>(bucketEnd - bucketStart);
+
+    if (!weightedSuccess || !lazySuccess || !bucketSuccess) {
+        std::cout << path << ": cannot cover all elements." << std::endl;
+        return;
+    }
+
+    // Пропускная способность — ненулевые элементы матрицы покрытия в секунду
+    double nonzeros = sets.totalSize();
+    std::cout << path << ": " << n << " rows, " << sets.size() << " columns, " << sets.totalSize() << " nonzeros" << std::endl;
+    std::cout << "Load time: " << loadDuration.count() << " microseconds ("
+              << nonzeros / std::max<long long>(1, loadDuration.count()) << " M nonzeros/s)" << std::endl;
+    std::cout << "Weighted greedy: cost " << sets.totalCost(weightedCover) << ", " << weightedCover.size() << " sets, "
+              << weightedDuration.count() << " microseconds" << std::endl;
+    std::cout << "Lazy greedy: cost " << sets.totalCost(lazyCover) << ", " << lazyCover.size() << " sets, "
+              << lazyDuration.count() << " microseconds" << std::endl;
+    std::cout << "Bucket greedy: cost " << sets.totalCost(bucketCover) << ", " << bucketCover.size() << " sets, "
+              << bucketDuration.count() << " microseconds" << std::endl;
+
+    outputFile << path << "," << n << "," << sets.size() << "," << sets.totalSize() << "," << loadDuration.count() << ","
+               << weightedDuration.count() << "," << weightedCover.size() << "," << sets.totalCost(weightedCover) << ","
+               << lazyDuration.count() << "," << lazyCover.size() << "," << sets.totalCost(lazyCover) << ","
+               << bucketDuration.count() << "," << bucketCover.size() << "," << sets.totalCost(bucketCover) << "\n";
+}
+
+int main(int argc, char *argv[]) {
+    const char *kernelName;
+    selectAndNotPopcountKernel(&kernelName);
+    std::cout << "Popcount kernel: " << kernelName << std::endl;
+
+    ThreadPool pool;
+
+    // Режим OR-Library: greedy_set_test --orlib <файл>...
+    if (argc >= 3 && std::string(argv[1]) == "--orlib") {
+        std::ofstream outputFile("performance_data_orlib.csv");
+        outputFile << "Instance,Rows,Columns,Nonzeros,LoadTime,WeightedExecutionTime,WeightedCoverSize,WeightedCoverCost,"
+                      "LazyExecutionTime,LazyCoverSize,LazyCoverCost,BucketExecutionTime,BucketCoverSize,BucketCoverCost\n";
+        for (int i = 2; i < argc; ++i) {
+            measureOrLibrary(argv[i], pool, outputFile);
+            std::cout << "-----------------------------" << std::endl;
+        }
+        outputFile.close();
+        return 0;
+    }
+
     std::ofstream outputFile("performance_data_greedy.csv");
-    outputFile << "Elements,Sets,SetType,ExecutionTime,CoverSize\n";
+    outputFile << "Elements,Sets,SetType,ExecutionTime,CoverSize,LazyExecutionTime,LazyCoverSize,BucketExecutionTime,BucketCoverSize,BitsetExecutionTime,BitsetCoverSize,ParallelExecutionTime,ParallelCoverSize,CoverCost,WeightedExecutionTime,WeightedCoverSize,WeightedCoverCost\n";
 
     std::cout << "Small sets (10 elements, 5 sets):" << std::endl;
-    measurePerformance(10, 5, 1, outputFile);
-    measurePerformance(10, 5, 2, outputFile);
-    measurePerformance(10, 5, 3, outputFile);
+    measurePerformance(10, 5, 1, pool, outputFile);
+    measurePerformance(10, 5, 2, pool, outputFile);
+    measurePerformance(10, 5, 3, pool, outputFile);
     std::cout << "-----------------------------" << std::endl;
 
     std::cout << "Medium sets (100 elements, 50 sets):" << std::endl;
-    measurePerformance(100, 50, 1, outputFile);
-    measurePerformance(100, 50, 2, outputFile);
-    measurePerformance(100, 50, 3, outputFile);
+    measurePerformance(100, 50, 1, pool, outputFile);
+    measurePerformance(100, 50, 2, pool, outputFile);
+    measurePerformance(100, 50, 3, pool, outputFile);
     std::cout << "-----------------------------" << std::endl;
 
     std::cout << "Large sets (1000 elements, 500 sets):" << std::endl;
-    measurePerformance(1000, 500, 1, outputFile);
-    measurePerformance(1000, 500, 2, outputFile);
-    measurePerformance(1000, 500, 3, outputFile);
+    measurePerformance(1000, 500, 1, pool, outputFile);
+    measurePerformance(1000, 500, 2, pool, outputFile);
+    measurePerformance(1000, 500, 3, pool, outputFile);
+    std::cout << "-----------------------------" << std::endl;
+
+    std::cout << "Memory footprint (10^7 total elements):" << std::endl;
+    measureMemory(1000000, 1000, 10000);
     std::cout << "-----------------------------" << std::endl;
 
     outputFile.close();
@@ -0,0 +1,131 @@
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+
+#include "set_system.h"
+#include "binary_format.h"
+#include "csr_graph.h"
+
+// Множества в формате greedy_set: "n m", элементы каждого множества до -1, затем (необязательно) m стоимостей
+bool convertSets(std::ifstream &input, const std::string &outputPath) {
+    int n, m;
+    if (!(input >> n >> m)) return false;
+
+    SetSystem sets;
+    std::vector<int> setElements;
+    for (int i = 0; i < m; ++i) {
+        int element;
+        setElements.clear();
+        while (input >> element && element != -1) {
+            setElements.push_back(element);
+        }
+        sets.addSet(setElements);
+    }
+
+    double cost;
+    while ((int) sets.costs.size() < m && input >> cost) {
+        sets.costs.push_back(cost);
+    }
+    if (!sets.costs.empty() && (int) sets.costs.size() != m) {
+        std::cout << "Expected " << m << " set costs, got " << sets.costs.size() << std::endl;
+        return false;
+    }
+
+    std::cout << "Sets: " << m << ", elements: " << sets.totalSize() << (sets.weighted() ? ", with costs" : "") << std::endl;
+    return writeSetSystemBinary(outputPath, sets, n);
+}
+
+// Множества в формате genetic_algorithm: "n m", затем для каждого множества размер и элементы
+bool convertGeneticSets(std::ifstream &input, const std::string &outputPath) {
+    int n, m;
+    if (!(input >> n >> m)) return false;
+
+    SetSystem sets;
+    std::vector<int> setElements;
+    for (int i = 0; i < m; ++i) {
+        int setSize;
+        if (!(input >> setSize)) return false;
+        setElements.resize(setSize);
+        for (int j = 0; j < setSize; ++j) {
+            input >> setElements[j];
+        }
+        sets.addSet(setElements);
+    }
+
+    std::cout << "Sets: " << m << ", elements: " << sets.totalSize() << std::endl;
+    return input && writeSetSystemBinary(outputPath, sets, n);
+}
+
+// Граф в формате greedy_cover ("V E", рёбра u v с нуля) или pricing_method
+// ("V E", веса вершин, рёбра u v с единицы)
+bool convertGraph(std::ifstream &input, const std::string &outputPath, bool weighted) {
+    int V;
+    long long E;
+    if (!(input >> V >> E)) return false;
+
+    EdgeList edgeList(V);
+    if (weighted) {
+        for (int i = 0; i < V; ++i) {
+            int w;
+            input >> w;
+            edgeList.setWeight(i, w);
+        }
+    }
+
+    edgeList.edges.reserve(E);
+    for (long long i = 0; i < E; ++i) {
+        int u, v;
+        input >> u >> v;
+        if (weighted) {
+            u--;
+            v--;
+        }
+        if (u < 0 || u >= V || v < 0 || v >= V) {
+            std::cout << "Edge " << i + 1 << " has an endpoint out of range" << std::endl;
+            return false;
+        }
+        edgeList.addEdge(u, v);
+    }
+    if (!input) return false;
+
+    ThreadPool pool;
+    CsrGraph graph = buildCsrGraph(edgeList, pool);
+
+    std::cout << "Vertices: " << V << ", edges: " << E << (weighted ? ", with weights" : "") << std::endl;
+    return writeGraphBinary(outputPath, graph);
+}
+
+int main(int argc, char *argv[]) {
+    if (argc < 4) {
+        std::cout << "Usage: instance_converter <sets|genetic-sets|graph|weighted-graph> <text input> <binary output>" << std::endl;
+        return 1;
+    }
+
+    std::string format = argv[1];
+    std::ifstream input(argv[2]);
+    if (!input) {
+        std::cout << "Cannot open " << argv[2] << std::endl;
+        return 1;
+    }
+
+    bool success;
+    if (format == "sets") {
+        success = convertSets(input, argv[3]);
+    } else if (format == "genetic-sets") {
+        success = convertGeneticSets(input, argv[3]);
+    } else if (format == "graph") {
+        success = convertGraph(input, argv[3], false);
+    } else if (format == "weighted-graph") {
+        success = convertGraph(input, argv[3], true);
+    } else {
+        std::cout << "Unknown format: " << format << std::endl;
+        return 1;
+    }
+
+    if (!success) {
+        std::cout << "Conversion failed." << std::endl;
+        return 1;
+    }
+    return 0;
+}
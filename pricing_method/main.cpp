@@ -1,74 +1,177 @@
 #include <iostream>
 #include <vector>
-#include <unordered_set>
-
-
-// Структура для представления графа
-struct Graph {
-    int V;
-    int E;
-    std::vector<std::vector<int>> adj;
-    std::vector<int> weights;
-
-    Graph(int V, int E) : V(V), E(E) {
-        adj.resize(V);
-        weights.resize(V, 0);
+#include <string>
+#include <cstdlib>
+
+#include "binary_format.h"
+#include "csr_graph.h"
+#include "graph_components.h"
+#include "graph_reader.h"
+#include "pricing.h"
+#include "text_parser.h"
+#include "vc_kernel.h"
+
+// Граф из последовательности чисел в формате ввода: V E, веса вершин, затем рёбра u v (с единицы)
+bool graphFromIntegers(const std::vector<int> &values, CsrGraph &graph, ThreadPool &pool) {
+    if (values.size() < 2 || values[0] < 0 || values[1] < 0 ||
+        values.size() - 2 < (std::size_t) values[0] + 2 * (std::size_t) values[1]) {
+        std::cout << "Missing header (V E), weights or edges" << std::endl;
+        return false;
     }
-
-    void addEdge(int u, int v) {
-        adj[u].push_back(v);
-        adj[v].push_back(u);
+    int V = values[0];
+    int E = values[1];
+    EdgeList edgeList(V);
+    edgeList.edges.reserve(E);
+    for (int i = 0; i < V; ++i) {
+        edgeList.setWeight(i, values[2 + i]);
     }
-
-    void setWeight(int v, int w) {
-        weights[v] = w;
+    std::size_t position = 2 + V;
+    for (int i = 0; i < E; ++i) {
+        int u = values[position++];
+        int v = values[position++];
+        if (u < 1 || u > V || v < 1 || v > V) {
+            std::cout << "Edge " << i + 1 << " has an endpoint out of range" << std::endl;
+            return false;
+        }
+        edgeList.addEdge(u - 1, v - 1);
     }
-};
+    graph = buildCsrGraph(edgeList, pool);
+    return true;
+}
 
-bool isTight(const std::vector<int>& prices, const Graph& graph, int v) {
-    int sumPrices = 0;
-    for (int u : graph.adj[v]) {
-        sumPrices += prices[u];
+// Выбранный метод оценки: 1 — исходный по компонентам связности, 2 — за один проход,
+// 3 — параллельный за один проход, 4 — по раундам с точностью epsilon. Сводки алгоритмов печатаются здесь.
+std::vector<int> runPricing(const CsrGraph& graph, ThreadPool& pool, int algorithm, double epsilon) {
+    if (algorithm == 2 || algorithm == 3) {
+        long long dualValue;
+        std::vector<int> result = algorithm == 3 ? parallelPricingMethod(graph, pool, &dualValue) : residualPricingMethod(graph, &dualValue);
+        std::cout << "Sum of edge prices (lower bound on the optimum): " << dualValue << std::endl;
+        return result;
     }
-    return sumPrices >= graph.weights[v];
+    if (algorithm == 4) {
+        RoundPricingStats stats;
+        std::vector<int> result = roundPricingMethod(graph, pool, epsilon, &stats);
+        std::cout << "Sum of edge prices (lower bound on the optimum): " << stats.dualValue << std::endl;
+        std::cout << "Rounds: " << stats.rounds << ", round times (us):";
+        for (long long time : stats.roundTime) {
+            std::cout << " " << time;
+        }
+        std::cout << std::endl;
+        return result;
+    }
+    ComponentStats components;
+    std::vector<int> result = componentPricingMethod(graph, pool, &components);
+    std::cout << "Components: " << components.components << " in " << components.parts << " parts, isolated vertices: " << components.isolated
+              << ", decomposition time: " << components.decompositionTime << " us" << std::endl;
+    return result;
+}
+
+// Метод оценки на ядре: сведение графа, решение ядра и подъём покрытия в исходный граф
+std::vector<int> kernelPricingMethod(const CsrGraph& graph, ThreadPool& pool, int algorithm, double epsilon) {
+    VertexCoverKernel kernel = reduceVertexCover(graph, pool);
+    std::cout << "Kernel: " << kernel.graph.V << " vertices, " << kernel.graph.E << " edges (of " << graph.V << ", " << graph.E
+              << "), reduction time: " << kernel.reductionTime << " us" << std::endl;
+    return kernel.lift(runPricing(kernel.graph, pool, algorithm, epsilon));
 }
 
-std::vector<int> pricingMethod(const Graph& graph) {
-    int V = graph.V;
-    std::vector<int> prices(V, 0); // начальные цены
-    std::unordered_set<int> vertexCover;
-
-    while (true) {
-        bool found = false;
-
-        // Ищем ребро, у которого ни одна из вершин не является плотной
-        for (int u = 0; u < V; ++u) {
-            for (int v : graph.adj[u]) {
-                if (!isTight(prices, graph, u) && !isTight(prices, graph, v)) {
-                    // Увеличиваем цену ребра (u, v)
-                    int maxIncrease = std::min(graph.weights[u] - prices[u], graph.weights[v] - prices[v]);
-                    prices[u] += maxIncrease;
-                    prices[v] += maxIncrease;
-                    found = true;
-                }
+int main(int argc, char *argv[]) {
+    // Экземпляр из файла: pricing_method --binary|--text|--dimacs|--metis|--snap <файл> [1 — сведение к ядру]
+    // [алгоритм] [epsilon для метода по раундам] [--weights <файл весов вершин>] (в бинарном файле вершины нумеруются с 0, в текстовом — с единицы,
+    // как при вводе; если весов нет в файле, все веса равны 1)
+    ThreadPool pool;
+    std::vector<std::string> args;
+    std::string weightsPath;
+    for (int i = 1; i < argc; ++i) {
+        if (std::string(argv[i]) == "--weights" && i + 1 < argc) {
+            weightsPath = argv[++i];
+        } else {
+            args.push_back(argv[i]);
+        }
+    }
+    std::string inputFlag = args.size() >= 2 ? args[0] : "";
+    GraphFormat format;
+    if (inputFlag == "--replay") {
+        // Воспроизведение потока рёбер: pricing_method --replay <файл "u v t" или "-"> <окно>
+        // [--weights <файл весов вершин>]; покрытие поддерживается инкрементально
+        if (args.size() < 3) {
+            std::cout << "Usage: pricing_method --replay <file or -> <window> [--weights <file>]" << std::endl;
+            return 1;
+        }
+        std::vector<int> weights;
+        if (!weightsPath.empty() && !parseIntegerFile(weightsPath, weights, pool)) {
+            return 1;
+        }
+        DynamicPricing pricing(weights);
+        ReplayStats stats;
+        if (!replayEdgeStream(args[1], std::atoll(args[2].c_str()), pricing, stats)) {
+            return 1;
+        }
+        std::cout << "Batches: " << stats.batches << ", updates: " << stats.updates << ", update time: " << stats.updateTime
+                  << " us (" << (stats.batches > 0 ? (double) stats.updateTime / stats.batches : 0) << " us per batch)" << std::endl;
+        std::cout << "Edges in window: " << pricing.edgeCount() << ", cover weight: " << pricing.coverWeight()
+                  << ", sum of edge prices (lower bound on the optimum): " << pricing.dualValue() << std::endl;
+        std::cout << "Vertex cover: ";
+        for (int v : pricing.cover()) {
+            std::cout << v << " ";
+        }
+        std::cout << "\n";
+        return 0;
+    }
+    if (inputFlag == "--stream") {
+        // Потоковый режим: pricing_method --stream --dimacs|--snap <файл или "-" для стандартного ввода>
+        // [--weights <файл весов вершин>]; граф в памяти не строится
+        if (args.size() < 3 || !graphFormatFromFlag(args[1], format)) {
+            std::cout << "Usage: pricing_method --stream --dimacs|--snap <file or -> [--weights <file>]" << std::endl;
+            return 1;
+        }
+        std::vector<int> result;
+        long long dualValue;
+        long long edgeCount;
+        if (!streamingPricingMethod(args[2], format, weightsPath, pool, result, &dualValue, &edgeCount)) {
+            return 1;
+        }
+        std::cout << "Streamed " << edgeCount << " edges" << std::endl;
+        std::cout << "Sum of edge prices (lower bound on the optimum): " << dualValue << std::endl;
+        std::cout << "Vertex cover: ";
+        for (int v : result) {
+            std::cout << v << " ";
+        }
+        std::cout << "\n";
+        return 0;
+    }
+    if (inputFlag == "--binary" || inputFlag == "--text" || graphFormatFromFlag(inputFlag, format)) {
+        CsrGraph graph;
+        if (graphFormatFromFlag(inputFlag, format)) {
+            if (!loadGraphFile(args[1], format, weightsPath, graph, pool)) {
+                return 1;
+            }
+        } else if (inputFlag == "--binary") {
+            if (!loadGraphBinary(args[1], graph)) {
+                return 1;
+            }
+        } else {
+            std::vector<int> values;
+            if (!parseIntegerFile(args[1], values, pool) || !graphFromIntegers(values, graph, pool)) {
+                return 1;
             }
         }
+        bool useKernel = args.size() >= 3 && std::atoi(args[2].c_str()) == 1;
+        int algorithm = args.size() >= 4 ? std::atoi(args[3].c_str()) : 1;
+        double epsilon = args.size() >= 5 ? std::atof(args[4].c_str()) : 0.1;
+        if (epsilon < 0 || epsilon >= 1) {
+            std::cout << "Epsilon must be in [0, 1)" << std::endl;
+            return 1;
+        }
+        std::vector<int> result = useKernel ? kernelPricingMethod(graph, pool, algorithm, epsilon) : runPricing(graph, pool, algorithm, epsilon);
 
-        // Если больше нет неплотных ребер, выходим из цикла
-        if (!found) break;
-
-        // Добавляем все плотные вершины в покрытие
-        for (int i = 0; i < V; ++i) {
-            if (isTight(prices, graph, i)) {
-                vertexCover.insert(i);
-            }
+        std::cout << "Vertex cover: ";
+        for (int v : result) {
+            std::cout << v << " ";
         }
+        std::cout << "\n";
+        return 0;
     }
 
-    return std::vector<int>(vertexCover.begin(), vertexCover.end());
-}
-
-int main() {
     int V;
     int E;
 
@@ -77,7 +180,7 @@ int main() {
     std::cout << "Enter the number of edges:";
     std::cin >> E;
 
-    Graph graph(V, E);
+    EdgeList edgeList(V);
 
     // Задание весов вершин
     std::cout << "\nEnter the vertex weights:\n\n";
@@ -85,7 +188,7 @@ int main() {
         int w;
         std::cout << "Enter the weights of " << i << ":";
         std::cin >> w;
-        graph.setWeight(i, w);
+        edgeList.setWeight(i, w);
     }
 
     // Добавление ребер
@@ -95,10 +198,29 @@ int main() {
         int v;
         std::cout << "Edge " << i + 1 << ":";
         std::cin >> u >> v;
-        graph.addEdge(u - 1, v - 1);
+        edgeList.addEdge(u - 1, v - 1);
+    }
+
+    int useKernel;
+    std::cout << "\nReduce to kernel first (0 - no, 1 - yes):";
+    std::cin >> useKernel;
+
+    int algorithm;
+    std::cout << "Select algorithm (1 - pricing, 2 - single-pass pricing, 3 - parallel pricing, 4 - round-based pricing):";
+    std::cin >> algorithm;
+
+    double epsilon = 0.1;
+    if (algorithm == 4) {
+        std::cout << "Enter epsilon (0 <= epsilon < 1):";
+        std::cin >> epsilon;
+        if (epsilon < 0 || epsilon >= 1) {
+            std::cout << "Epsilon must be in [0, 1)" << std::endl;
+            return 1;
+        }
     }
 
-    std::vector<int> result = pricingMethod(graph);
+    CsrGraph graph = buildCsrGraph(edgeList, pool);
+    std::vector<int> result = useKernel == 1 ? kernelPricingMethod(graph, pool, algorithm, epsilon) : runPricing(graph, pool, algorithm, epsilon);
 
     // Вывод результата
     std::cout << "Vertex cover: ";
@@ -6,70 +6,41 @@
 #include <algorithm>
 #include <cmath>
 #include <fstream>
+#include <thread>
+#include <string>
+#include <cstdio>
 
-using namespace std::chrono;
-
-struct Graph {
-    int V, E;
-    std::vector<std::vector<int>> adj;
-    std::vector<int> weights;
-
-    Graph(int V) : V(V), E(0) {
-        adj.resize(V);
-        weights.resize(V, 0);
-    }
+#include "csr_graph.h"
+#include "edge_stream.h"
+#include "graph_components.h"
+#include "pricing.h"
+#include "vc_kernel.h"
 
-    void addEdge(int u, int v) {
-        adj[u].push_back(v);
-        adj[v].push_back(u);
-        E++;
-    }
+using namespace std::chrono;
 
-    void setWeight(int v, int w) {
-        weights[v] = w;
+// Проверка покрытия и его вес
+bool isVertexCover(const CsrGraph& graph, const std::vector<int>& cover) {
+    std::vector<char> inCover(graph.V, 0);
+    for (int v : cover) {
+        inCover[v] = 1;
     }
-};
-
-bool isTight(const std::vector<int>& prices, const Graph& graph, int v) {
-    int sumPrices = 0;
-    for (int u : graph.adj[v]) {
-        sumPrices += prices[u];
+    for (int u = 0; u < graph.V; ++u) {
+        for (int v : graph.neighborsOf(u)) {
+            if (!inCover[u] && !inCover[v]) return false;
+        }
     }
-    return sumPrices >= graph.weights[v];
+    return true;
 }
 
-std::vector<int> pricingMethod(const Graph& graph) {
-    int V = graph.V;
-    std::vector<int> prices(V, 0);
-    std::unordered_set<int> vertexCover;
-
-    while (true) {
-        bool found = false;
-
-        for (int u = 0; u < V; ++u) {
-            for (int v : graph.adj[u]) {
-                if (!isTight(prices, graph, u) && !isTight(prices, graph, v)) {
-                    int maxIncrease = std::min(graph.weights[u] - prices[u], graph.weights[v] - prices[v]);
-                    prices[u] += maxIncrease;
-                    prices[v] += maxIncrease;
-                    found = true;
-                }
-            }
-        }
-
-        if (!found) break;
-
-        for (int i = 0; i < V; ++i) {
-            if (isTight(prices, graph, i)) {
-                vertexCover.insert(i);
-            }
-        }
+long long coverWeight(const CsrGraph& graph, const std::vector<int>& cover) {
+    long long weight = 0;
+    for (int v : cover) {
+        weight += graph.weight(v);
     }
-
-    return std::vector<int>(vertexCover.begin(), vertexCover.end());
+    return weight;
 }
 
-void generateRandomGraph(Graph &graph, int E) {
+void generateRandomGraph(EdgeList &graph, int E) {
     std::random_device rd;
     std::mt19937 gen(rd());
     std::uniform_int_distribution<> dis(0, graph.V - 1);
@@ -90,7 +61,7 @@ void generateRandomGraph(Graph &graph, int E) {
     }
 }
 
-void generateGridGraph(Graph &graph, int rows, int cols) {
+void generateGridGraph(EdgeList &graph, int rows, int cols) {
     std::uniform_int_distribution<> weightDis(1, 10);
     std::random_device rd;
     std::mt19937 gen(rd());
@@ -105,7 +76,7 @@ void generateGridGraph(Graph &graph, int rows, int cols) {
     }
 }
 
-void generateClusterGraph(Graph &graph, int clusters, int clusterSize, int interClusterEdges) {
+void generateClusterGraph(EdgeList &graph, int clusters, int clusterSize, int interClusterEdges) {
     std::uniform_int_distribution<> weightDis(1, 10);
     std::random_device rd;
     std::mt19937 gen(rd());
@@ -133,21 +104,30 @@ void generateClusterGraph(Graph &graph, int clusters, int clusterSize, int inter
     }
 }
 
-void measurePerformance(int V, int E, int graphType, std::ofstream &outputFile) {
-    Graph graph(V);
+// Граф выбранного типа (1 — случайный, 2 — решётка, 3 — кластеры) в CSR; список рёбер
+// освобождается до возврата
+CsrGraph generateGraph(int V, int E, int graphType, ThreadPool &pool, CsrBuildStats *stats = nullptr) {
+    EdgeList edgeList(V);
 
     if (graphType == 1) {
-        generateRandomGraph(graph, E);
+        generateRandomGraph(edgeList, E);
     } else if (graphType == 2) {
         int rows = std::sqrt(V);
         int cols = V / rows;
-        generateGridGraph(graph, rows, cols);
+        generateGridGraph(edgeList, rows, cols);
     } else if (graphType == 3) {
         int clusters = std::sqrt(V);
         int clusterSize = V / clusters;
         int interClusterEdges = E - (clusters * clusterSize * (clusterSize - 1) / 2);
-        generateClusterGraph(graph, clusters, clusterSize, interClusterEdges);
+        generateClusterGraph(edgeList, clusters, clusterSize, interClusterEdges);
     }
+    return buildCsrGraph(edgeList, pool, stats);
+}
+
+void measurePerformance(int V, int E, int graphType, ThreadPool &pool, std::ofstream &outputFile) {
+    // Случайный генератор повторяет рёбра, при построении они отбрасываются
+    CsrBuildStats buildStats;
+    CsrGraph graph = generateGraph(V, E, graphType, pool, &buildStats);
 
     auto start = high_resolution_clock::now();
     std::vector<int> result = pricingMethod(graph);
@@ -156,33 +136,368 @@ void measurePerformance(int V, int E, int graphType, std::ofstream &outputFile)
     auto duration = duration_cast<microseconds>(end - start).count();
     int coverSize = result.size();
 
-    outputFile << V << "," << E << "," << graphType << "," << coverSize << "," << duration << "\n";
+    // Метод оценки по компонентам связности: время включает разбиение
+    auto componentStart = high_resolution_clock::now();
+    GraphComponents components = splitComponents(graph, pool);
+    std::vector<int> componentResult = solveComponents(components, pool, pricingMethod);
+    auto componentEnd = high_resolution_clock::now();
+
+    auto componentDuration = duration_cast<microseconds>(componentEnd - componentStart).count();
+
+    // Метод оценки на ядре: время включает сведение и подъём покрытия
+    auto kernelStart = high_resolution_clock::now();
+    VertexCoverKernel kernel = reduceVertexCover(graph, pool);
+    std::vector<int> kernelResult = kernel.lift(pricingMethod(kernel.graph));
+    auto kernelEnd = high_resolution_clock::now();
+
+    auto kernelDuration = duration_cast<microseconds>(kernelEnd - kernelStart).count();
+
+    outputFile << V << "," << E << "," << graphType << "," << coverSize << "," << duration << "," << coverWeight(graph, result)
+               << "," << kernel.graph.V << "," << kernel.graph.E << "," << kernel.reductionTime << "," << kernelResult.size() << ","
+               << coverWeight(graph, kernelResult) << "," << kernelDuration << "," << buildStats.duplicateEdges
+               << "," << components.components << "," << componentResult.size() << "," << componentDuration << "\n";
 
     std::cout << "Vertices: " << V << ", Edges: " << E << ", GraphType: " << graphType << ", CoverSize: " << coverSize << ", ExecutionTime: " << duration << " us" << std::endl;
+    std::cout << "Graph built with " << graph.E << " edges, duplicate edges dropped: " << buildStats.duplicateEdges << std::endl;
+    std::cout << "Kernel: " << kernel.graph.V << " vertices, " << kernel.graph.E << " edges, ReductionTime: " << kernel.reductionTime
+              << " us, Kernel pricing CoverSize: " << kernelResult.size() << ", CoverWeight: " << coverWeight(graph, kernelResult)
+              << " (without kernel " << coverWeight(graph, result) << "), ExecutionTime: " << kernelDuration << " us" << std::endl;
+    std::cout << "Components: " << components.components << ", Component pricing CoverSize: " << componentResult.size()
+              << ", ExecutionTime: " << componentDuration << " us" << std::endl;
+    // Изолированные вершины нулевого веса плотны и попадают в покрытие всего графа, в компоненты они не входят
+    std::unordered_set<int> coveringResult;
+    for (int v : result) {
+        if (graph.degree(v) > 0) coveringResult.insert(v);
+    }
+    if (std::unordered_set<int>(componentResult.begin(), componentResult.end()) != coveringResult) {
+        std::cout << "Component pricing cover differs from pricing cover!" << std::endl;
+    }
+    if (!isVertexCover(graph, kernelResult)) {
+        std::cout << "Kernel pricing result is not a vertex cover!" << std::endl;
+    }
+}
+
+// Метод оценки за один проход против исходного: время, вес покрытия и нижняя оценка (сумма цен рёбер)
+void measureResidualPricing(int V, int E, int graphType, ThreadPool &pool, std::ofstream &outputFile) {
+    CsrGraph graph = generateGraph(V, E, graphType, pool);
+
+    auto start = high_resolution_clock::now();
+    std::vector<int> result = pricingMethod(graph);
+    auto end = high_resolution_clock::now();
+
+    auto duration = duration_cast<microseconds>(end - start).count();
+
+    long long dualValue;
+    auto residualStart = high_resolution_clock::now();
+    std::vector<int> residualResult = residualPricingMethod(graph, &dualValue);
+    auto residualEnd = high_resolution_clock::now();
+
+    auto residualDuration = duration_cast<microseconds>(residualEnd - residualStart).count();
+    double speedup = residualDuration > 0 ? (double) duration / residualDuration : 0;
+
+    outputFile << V << "," << graph.E << "," << graphType << "," << coverWeight(graph, result) << "," << duration << ","
+               << coverWeight(graph, residualResult) << "," << dualValue << "," << residualDuration << "," << speedup << "\n";
+
+    std::cout << "Vertices: " << V << ", Edges: " << graph.E << ", GraphType: " << graphType << ", CoverWeight: " << coverWeight(graph, result)
+              << ", ExecutionTime: " << duration << " us" << std::endl;
+    std::cout << "Single-pass pricing CoverWeight: " << coverWeight(graph, residualResult) << ", LowerBound: " << dualValue
+              << ", ExecutionTime: " << residualDuration << " us, Speedup: " << speedup << std::endl;
+    if (!isVertexCover(graph, residualResult)) {
+        std::cout << "Single-pass pricing result is not a vertex cover!" << std::endl;
+    }
+    if (coverWeight(graph, residualResult) > 2 * dualValue) {
+        std::cout << "Single-pass pricing cover exceeds twice the lower bound!" << std::endl;
+    }
+}
+
+// Параллельный метод оценки при росте числа потоков от 1 до числа ядер против однопроходного
+void measureParallelPricing(int V, int E, int graphType, ThreadPool &pool, std::ofstream &outputFile) {
+    CsrGraph graph = generateGraph(V, E, graphType, pool);
+
+    long long residualDual;
+    auto residualStart = high_resolution_clock::now();
+    std::vector<int> residualResult = residualPricingMethod(graph, &residualDual);
+    auto residualEnd = high_resolution_clock::now();
+    long long residualDuration = duration_cast<microseconds>(residualEnd - residualStart).count();
+
+    int maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<int> threadCounts;
+    for (int threads = 1; threads < maxThreads; threads *= 2) {
+        threadCounts.push_back(threads);
+    }
+    threadCounts.push_back(maxThreads);
+
+    for (int threads : threadCounts) {
+        ThreadPool threadPool(threads);
+        long long dualValue;
+        auto start = high_resolution_clock::now();
+        std::vector<int> result = parallelPricingMethod(graph, threadPool, &dualValue);
+        auto end = high_resolution_clock::now();
+
+        long long duration = duration_cast<microseconds>(end - start).count();
+        double speedup = duration > 0 ? (double) residualDuration / duration : 0;
+
+        outputFile << V << "," << graph.E << "," << graphType << "," << threads << "," << coverWeight(graph, result) << "," << dualValue << ","
+                   << duration << "," << coverWeight(graph, residualResult) << "," << residualDuration << "," << speedup << "\n";
+
+        std::cout << "Vertices: " << V << ", Edges: " << graph.E << ", GraphType: " << graphType << ", Threads: " << threads
+                  << ", CoverWeight: " << coverWeight(graph, result) << ", LowerBound: " << dualValue << ", ExecutionTime: " << duration
+                  << " us (single pass " << residualDuration << " us), Speedup: " << speedup << std::endl;
+        if (!isVertexCover(graph, result)) {
+            std::cout << "Parallel pricing result is not a vertex cover!" << std::endl;
+        }
+        if (coverWeight(graph, result) > 2 * dualValue) {
+            std::cout << "Parallel pricing cover exceeds twice the lower bound!" << std::endl;
+        }
+    }
+}
+
+// Метод оценки по раундам при разных epsilon: число раундов, время и вес покрытия против однопроходного;
+// время каждого раунда пишется в отдельный файл
+void measureRoundPricing(int V, int E, int graphType, const std::vector<double> &epsilons, ThreadPool &pool,
+                         std::ofstream &outputFile, std::ofstream &roundFile) {
+    CsrGraph graph = generateGraph(V, E, graphType, pool);
+
+    std::vector<int> residualResult = residualPricingMethod(graph);
+
+    for (double epsilon : epsilons) {
+        RoundPricingStats stats;
+        auto start = high_resolution_clock::now();
+        std::vector<int> result = roundPricingMethod(graph, pool, epsilon, &stats);
+        auto end = high_resolution_clock::now();
+
+        long long duration = duration_cast<microseconds>(end - start).count();
+
+        outputFile << V << "," << graph.E << "," << graphType << "," << epsilon << "," << stats.rounds << "," << duration << ","
+                   << coverWeight(graph, result) << "," << stats.dualValue << "," << coverWeight(graph, residualResult) << "\n";
+        for (int round = 0; round < stats.rounds; ++round) {
+            roundFile << V << "," << graph.E << "," << graphType << "," << epsilon << "," << round + 1 << ","
+                      << stats.activeEdges[round] << "," << stats.roundTime[round] << "\n";
+        }
+
+        std::cout << "Vertices: " << V << ", Edges: " << graph.E << ", GraphType: " << graphType << ", Epsilon: " << epsilon
+                  << ", Rounds: " << stats.rounds << ", ExecutionTime: " << duration << " us, CoverWeight: " << coverWeight(graph, result)
+                  << ", LowerBound: " << stats.dualValue << " (single pass " << coverWeight(graph, residualResult) << ")" << std::endl;
+        if (!isVertexCover(graph, result)) {
+            std::cout << "Round-based pricing result is not a vertex cover!" << std::endl;
+        }
+        if (coverWeight(graph, result) > 2 / (1 - epsilon) * stats.dualValue + 1e-6) {
+            std::cout << "Round-based pricing cover exceeds the 2 / (1 - epsilon) bound!" << std::endl;
+        }
+    }
+}
+
+// Потоковый метод оценки по файлу SNAP против загрузки графа в CSR и однопроходного метода:
+// время и объём состояния (O(V) против O(V + E) у загруженного графа)
+void measureStreaming(int V, int E, ThreadPool &pool, std::ofstream &outputFile) {
+    EdgeList edgeList(V);
+    generateRandomGraph(edgeList, E);
+
+    const std::string edgesPath = "stream_edges.txt";
+    const std::string weightsPath = "stream_weights.txt";
+    std::FILE *edgesFile = std::fopen(edgesPath.c_str(), "w");
+    for (const auto &[u, v] : edgeList.edges) {
+        std::fprintf(edgesFile, "%d %d\n", u, v);
+    }
+    std::fclose(edgesFile);
+    std::FILE *weightsFile = std::fopen(weightsPath.c_str(), "w");
+    for (int w : edgeList.weights) {
+        std::fprintf(weightsFile, "%d\n", w);
+    }
+    std::fclose(weightsFile);
+    CsrGraph graph = buildCsrGraph(edgeList, pool);
+    std::vector<std::pair<int, int>>().swap(edgeList.edges);
+
+    std::vector<int> result;
+    long long dualValue = 0;
+    long long edgeCount = 0;
+    auto start = high_resolution_clock::now();
+    streamingPricingMethod(edgesPath, GraphFormat::Snap, weightsPath, pool, result, &dualValue, &edgeCount);
+    auto end = high_resolution_clock::now();
+    long long duration = duration_cast<microseconds>(end - start).count();
+
+    // Загрузка того же файла в CSR и однопроходный метод на нём
+    auto loadStart = high_resolution_clock::now();
+    CsrGraph loaded;
+    loadGraphFile(edgesPath, GraphFormat::Snap, weightsPath, loaded, pool);
+    std::vector<int> loadedResult = residualPricingMethod(loaded);
+    auto loadEnd = high_resolution_clock::now();
+    long long loadDuration = duration_cast<microseconds>(loadEnd - loadStart).count();
+
+    long long stateBytes = (long long) V * (sizeof(int) + sizeof(char));
+    long long graphBytes = (long long) loaded.offsets.size() * sizeof(long long) + (long long) loaded.neighbors.size() * sizeof(int)
+                         + (long long) loaded.weights.size() * sizeof(int);
+    double edgesPerSecond = duration > 0 ? edgeCount * 1e6 / duration : 0;
+
+    outputFile << V << "," << edgeCount << "," << coverWeight(graph, result) << "," << dualValue << "," << duration << "," << edgesPerSecond
+               << "," << stateBytes << "," << coverWeight(graph, loadedResult) << "," << loadDuration << "," << graphBytes << "\n";
+
+    std::cout << "Vertices: " << V << ", Edges: " << edgeCount << ", Streaming CoverWeight: " << coverWeight(graph, result)
+              << ", LowerBound: " << dualValue << ", ExecutionTime: " << duration << " us (" << edgesPerSecond << " edges/s), State: "
+              << stateBytes << " bytes" << std::endl;
+    std::cout << "Load + single-pass CoverWeight: " << coverWeight(graph, loadedResult) << ", ExecutionTime: " << loadDuration
+              << " us, Graph: " << graphBytes << " bytes" << std::endl;
+    if (!isVertexCover(graph, result)) {
+        std::cout << "Streaming pricing result is not a vertex cover!" << std::endl;
+    }
+    if (coverWeight(graph, result) > 2 * dualValue) {
+        std::cout << "Streaming pricing cover exceeds twice the lower bound!" << std::endl;
+    }
+    std::remove(edgesPath.c_str());
+    std::remove(weightsPath.c_str());
+}
+
+// Воспроизведение потока рёбер с метками времени в скользящем окне: среднее время пакета
+// инкрементального метода против пересчёта с нуля (построение CSR окна и однопроходный метод)
+void measureDynamicReplay(int V, int streamEdges, int edgesPerBatch, long long window, ThreadPool &pool, std::ofstream &outputFile) {
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_int_distribution<> dis(0, V - 1);
+    std::uniform_int_distribution<> weightDis(1, 10);
+
+    std::vector<int> weights(V);
+    for (int &w : weights) {
+        w = weightDis(gen);
+    }
+    const std::string streamPath = "stream_replay.txt";
+    std::vector<std::pair<int, int>> stream;
+    stream.reserve(streamEdges);
+    std::FILE *streamFile = std::fopen(streamPath.c_str(), "w");
+    for (int i = 0; i < streamEdges; ++i) {
+        int u = dis(gen);
+        int v = dis(gen);
+        if (u == v) {
+            --i;
+            continue;
+        }
+        stream.emplace_back(u, v);
+        std::fprintf(streamFile, "%d %d %d\n", u, v, i / edgesPerBatch);
+    }
+    std::fclose(streamFile);
+
+    DynamicPricing pricing(weights);
+    ReplayStats stats;
+    replayEdgeStream(streamPath, window, pricing, stats);
+    std::remove(streamPath.c_str());
+    double batchTime = stats.batches > 0 ? (double) stats.updateTime / stats.batches : 0;
+
+    // Граф последнего окна: рёбра с меткой больше последней минус window
+    long long lastTime = (streamEdges - 1) / edgesPerBatch;
+    EdgeList edgeList(V);
+    for (int i = 0; i < streamEdges; ++i) {
+        if (window == 0 || i / edgesPerBatch > lastTime - window) {
+            edgeList.addEdge(stream[i].first, stream[i].second);
+        }
+    }
+    for (int v = 0; v < V; ++v) {
+        edgeList.setWeight(v, weights[v]);
+    }
+    auto recomputeStart = high_resolution_clock::now();
+    CsrGraph graph = buildCsrGraph(edgeList, pool);
+    std::vector<int> recomputed = residualPricingMethod(graph);
+    auto recomputeEnd = high_resolution_clock::now();
+    long long recomputeTime = duration_cast<microseconds>(recomputeEnd - recomputeStart).count();
+    double speedup = batchTime > 0 ? recomputeTime / batchTime : 0;
+
+    std::vector<int> result = pricing.cover();
+    outputFile << V << "," << streamEdges << "," << edgesPerBatch << "," << window << "," << stats.batches << "," << stats.updates << ","
+               << stats.updateTime << "," << batchTime << "," << pricing.edgeCount() << "," << pricing.coverWeight() << ","
+               << pricing.dualValue() << "," << recomputeTime << "," << coverWeight(graph, recomputed) << "," << speedup << "\n";
+
+    std::cout << "Vertices: " << V << ", StreamEdges: " << streamEdges << ", EdgesPerBatch: " << edgesPerBatch << ", Window: " << window
+              << ", Batches: " << stats.batches << ", Updates: " << stats.updates << ", AverageBatchTime: " << batchTime << " us" << std::endl;
+    std::cout << "Window edges: " << pricing.edgeCount() << ", CoverWeight: " << pricing.coverWeight() << ", LowerBound: " << pricing.dualValue()
+              << ", Recompute CoverWeight: " << coverWeight(graph, recomputed) << ", RecomputeTime: " << recomputeTime
+              << " us, Speedup per batch: " << speedup << std::endl;
+    if (pricing.edgeCount() != graph.E || !isVertexCover(graph, result)) {
+        std::cout << "Dynamic pricing result is not a vertex cover of the window!" << std::endl;
+    }
+    if (pricing.coverWeight() > 2 * pricing.dualValue()) {
+        std::cout << "Dynamic pricing cover exceeds twice the lower bound!" << std::endl;
+    }
 }
 
 int main() {
+    ThreadPool pool;
     std::ofstream outputFile("performance_data.csv");
-    outputFile << "Vertices,Edges,GraphType,CoverSize,ExecutionTime\n";
+    outputFile << "Vertices,Edges,GraphType,CoverSize,ExecutionTime,CoverWeight,KernelVertices,KernelEdges,ReductionTime,KernelCoverSize,KernelCoverWeight,KernelExecutionTime,DuplicateEdges,Components,ComponentCoverSize,ComponentExecutionTime\n";
 
     std::cout << "Small graph (10 vertices, 15 edges):" << std::endl;
-    measurePerformance(10, 15, 1, outputFile);
-    measurePerformance(10, 15, 2, outputFile);
-    measurePerformance(10, 15, 3, outputFile);
+    measurePerformance(10, 15, 1, pool, outputFile);
+    measurePerformance(10, 15, 2, pool, outputFile);
+    measurePerformance(10, 15, 3, pool, outputFile);
     std::cout << "-----------------------------" << std::endl;
 
     std::cout << "Medium graph (100 vertices, 500 edges):" << std::endl;
-    measurePerformance(100, 500, 1, outputFile);
-    measurePerformance(100, 500, 2, outputFile);
-    measurePerformance(100, 500, 3, outputFile);
+    measurePerformance(100, 500, 1, pool, outputFile);
+    measurePerformance(100, 500, 2, pool, outputFile);
+    measurePerformance(100, 500, 3, pool, outputFile);
     std::cout << "-----------------------------" << std::endl;
 
     std::cout << "Large graph (1000 vertices, 5000 edges):" << std::endl;
-    measurePerformance(1000, 5000, 1, outputFile);
-    measurePerformance(1000, 5000, 2, outputFile);
-    measurePerformance(1000, 5000, 3, outputFile);
+    measurePerformance(1000, 5000, 1, pool, outputFile);
+    measurePerformance(1000, 5000, 2, pool, outputFile);
+    measurePerformance(1000, 5000, 3, pool, outputFile);
 
     outputFile.close();
 
+    std::ofstream residualFile("residual_pricing.csv");
+    residualFile << "Vertices,Edges,GraphType,CoverWeight,ExecutionTime,ResidualCoverWeight,LowerBound,ResidualExecutionTime,Speedup\n";
+
+    std::cout << "-----------------------------" << std::endl;
+    std::cout << "Single-pass pricing against the original method:" << std::endl;
+    measureResidualPricing(1000, 5000, 1, pool, residualFile);
+    measureResidualPricing(1000, 5000, 2, pool, residualFile);
+    measureResidualPricing(1000, 5000, 3, pool, residualFile);
+    measureResidualPricing(1000000, 10000000, 1, pool, residualFile);
+
+    residualFile.close();
+
+    std::ofstream parallelFile("parallel_pricing.csv");
+    parallelFile << "Vertices,Edges,GraphType,Threads,CoverWeight,LowerBound,ExecutionTime,ResidualCoverWeight,ResidualExecutionTime,Speedup\n";
+
+    std::cout << "-----------------------------" << std::endl;
+    std::cout << "Parallel pricing speedup:" << std::endl;
+    measureParallelPricing(1000000, 10000000, 1, pool, parallelFile);
+    measureParallelPricing(1000000, 2000000, 2, pool, parallelFile);
+
+    parallelFile.close();
+
+    std::ofstream roundPricingFile("round_pricing.csv");
+    roundPricingFile << "Vertices,Edges,GraphType,Epsilon,Rounds,ExecutionTime,CoverWeight,LowerBound,ResidualCoverWeight\n";
+    std::ofstream roundTimeFile("round_pricing_rounds.csv");
+    roundTimeFile << "Vertices,Edges,GraphType,Epsilon,Round,ActiveEdges,RoundTime\n";
+
+    std::cout << "-----------------------------" << std::endl;
+    std::cout << "Round-based pricing (rounds and quality by epsilon):" << std::endl;
+    std::vector<double> epsilons = {0.5, 0.2, 0.1, 0.01, 0.001};
+    measureRoundPricing(1000, 5000, 1, epsilons, pool, roundPricingFile, roundTimeFile);
+    measureRoundPricing(1000, 5000, 3, epsilons, pool, roundPricingFile, roundTimeFile);
+    measureRoundPricing(1000000, 10000000, 1, epsilons, pool, roundPricingFile, roundTimeFile);
+
+    roundPricingFile.close();
+    roundTimeFile.close();
+
+    std::ofstream streamingFile("streaming_pricing.csv");
+    streamingFile << "Vertices,Edges,CoverWeight,LowerBound,ExecutionTime,EdgesPerSecond,StateBytes,LoadedCoverWeight,LoadedExecutionTime,GraphBytes\n";
+
+    std::cout << "-----------------------------" << std::endl;
+    std::cout << "Streaming pricing over an edge file:" << std::endl;
+    measureStreaming(1000, 5000, pool, streamingFile);
+    measureStreaming(1000000, 10000000, pool, streamingFile);
+
+    streamingFile.close();
+
+    std::ofstream replayFile("dynamic_replay.csv");
+    replayFile << "Vertices,StreamEdges,EdgesPerBatch,Window,Batches,Updates,UpdateTime,AverageBatchTime,WindowEdges,CoverWeight,LowerBound,RecomputeTime,RecomputeCoverWeight,Speedup\n";
+
+    std::cout << "-----------------------------" << std::endl;
+    std::cout << "Dynamic pricing over a timestamped edge stream (sliding window):" << std::endl;
+    measureDynamicReplay(1000, 50000, 10, 500, pool, replayFile);
+    measureDynamicReplay(100000, 2000000, 100, 5000, pool, replayFile);
+    measureDynamicReplay(100000, 2000000, 1000, 500, pool, replayFile);
+
+    replayFile.close();
+
     return 0;
 }